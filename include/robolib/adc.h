@@ -2,13 +2,33 @@
 * robolib/adc.h                                                               *
 * =============                                                               *
 *                                                                             *
-* Version: 1.0.0                                                              *
-* Date   : 27.09.15                                                           *
+* Version: 1.7.0                                                              *
+* Date   : 19.10.26                                                           *
 * Author : Peter Weissig                                                      *
 *                                                                             *
 * Changelog:                                                                  *
 *   27.09.15(V1.0.0)                                                          *
 *     - first release                                                         *
+*   19.10.26(V1.1.0)                                                          *
+*     - conversions are interrupt driven                                      *
+*     - added adc_request() and adc_is_complete()                             *
+*     - optional noise reduction sleep (ADC_SLEEP)                            *
+*   19.10.26(V1.2.0)                                                          *
+*     - added adc_request_mask()                                              *
+*   19.10.26(V1.3.0)                                                          *
+*     - optional oversampling per channel (ADC_OVERSAMPLING)                  *
+*     - optional moving average per channel (ADC_AVERAGE)                     *
+*   19.10.26(V1.4.0)                                                          *
+*     - number of buffered channels is set at compile time (ADC_CHANNELS)     *
+*     - special channels are selected by ADC_MUX() (e.g. differential)        *
+*     - adc_request_mask() takes a 16-bit mask                                *
+*   19.10.26(V1.5.0)                                                          *
+*     - configurable prescaler, reference and left adjust                     *
+*     - optional 8-bit mode reading ADCH only (ADC_8BIT)                      *
+*   19.10.26(V1.6.0)                                                          *
+*     - optional auto trigger by a timer (ADC_TRIGGER)                        *
+*   19.10.26(V1.7.0)                                                          *
+*     - optional filter per channel (ADC_FILTER)                              *
 *                                                                             *
 * For help or bug report please visit:                                        *
 *   https://github.com/RoboAG/avr_robolib                                     *
@@ -19,10 +39,169 @@
 
 //**************************<Macros>*******************************************
 //! The number of bytes the adc modul uses in order to work
-#define ROBOLIB_RAM_COUNT_ADC 8
+#define ROBOLIB_RAM_COUNT_ADC \
+  (10 + 2 * ADC_CHANNELS + ROBOLIB_RAM_COUNT_ADC_OVERSAMPLING + \
+  ROBOLIB_RAM_COUNT_ADC_AVERAGE + ROBOLIB_RAM_COUNT_ADC_TRIGGER + \
+  ROBOLIB_RAM_COUNT_ADC_FILTER)
+
+//! Filter of a channel: none (filtered value equals the raw value)
+#define ADC_FILTER_NONE       0x00
+//! Filter of a channel: single pole iir y+= (x - y) / 2^shift [shift 1..8]
+#define ADC_FILTER_IIR(shift) (0x10 | (((shift) - 1) & 0x07))
+//! Filter of a channel: median of the last 3 values
+#define ADC_FILTER_MEDIAN3    0x20
+//! Filter of a channel: median of the last 5 values
+#define ADC_FILTER_MEDIAN5    0x30
+
+//! Reference voltage: external voltage at AREF
+#define ADC_REF_AREF 0x00
+//! Reference voltage: AVCC (with external capacitor at AREF)
+#define ADC_REF_AVCC 0x40
+
+#if defined(__AVR_ATmega328P__)
+    #define ADC_REF_1V1  0xC0
+#elif defined(__AVR_ATmega64__)
+    #define ADC_REF_2V56 0xC0
+#else
+    //! Reference voltage: internal 1.1V (not available for the atmega64)
+    #define ADC_REF_1V1  0x80
+    //! Reference voltage: internal 2.56V (not available for the atmega328p)
+    #define ADC_REF_2V56 0xC0
+#endif
+
+//! Channel descriptor of a raw multiplexer setting (see datasheet)
+#define ADC_MUX(mux) (0x40 | ((mux) & 0x3F))
+
+#if defined(__AVR_ATmega328P__) || defined(__DOXYGEN__)
+    //! Channel descriptor of the internal bandgap reference
+    #define ADC_BANDGAP     ADC_MUX(0x0E)
+    //! Channel descriptor of ground (0V)
+    #define ADC_GND         ADC_MUX(0x0F)
+    //! Channel descriptor of the internal temperature sensor (atmega328p)
+    #define ADC_TEMPERATURE ADC_MUX(0x08)
+#else
+    #define ADC_BANDGAP     ADC_MUX(0x1E)
+    #define ADC_GND         ADC_MUX(0x1F)
+#endif
+
+#if !defined(__AVR_ATmega328P__) || defined(__DOXYGEN__)
+    /**
+     * @brief Channel descriptor of a differential input with gain 1.
+     *
+     * The negative input must be ADC1 or ADC2 (ADC9 or ADC10 for the
+     * upper inputs of the atmega2561 family).
+     * Not available for the atmega328p.
+     */
+    #define ADC_DIFF_X1(pos, neg) ADC_MUX(((pos) & 0x08) << 2 | \
+      ((((neg) & 0x07) == 1) ? 0x10 : 0x18) | ((pos) & 0x07))
+
+    /**
+     * @brief Channel descriptor of a differential input with gain 10.
+     *
+     * Allowed inputs are ADC0/ADC1 - ADC0 and ADC2/ADC3 - ADC2
+     * (ADC8..ADC11 for the upper inputs of the atmega2561 family).
+     * Not available for the atmega328p.
+     */
+    #define ADC_DIFF_X10(pos, neg) ADC_MUX(((pos) & 0x08) << 2 | 0x08 | \
+      (((neg) & 0x02) << 1) | ((pos) & 0x01))
+
+    /**
+     * @brief Channel descriptor of a differential input with gain 200.
+     *
+     * See ADC_DIFF_X10() for the allowed inputs.
+     * Not available for the atmega328p.
+     */
+    #define ADC_DIFF_X200(pos, neg) (ADC_DIFF_X10(pos, neg) | 0x02)
+#endif
 
 #ifndef __DOXYGEN__
 
+    // number of single ended inputs
+    #if defined(__AVR_ATmega2561__)
+        // ADC8..ADC15 are only bonded out on the 100-pin devices
+        // of this family (e.g. atmega2560)
+        #define ROBOLIB_ADC_INPUTS 16
+    #else
+        #define ROBOLIB_ADC_INPUTS  8
+    #endif
+
+    // number of buffered channels (channels 0 .. ADC_CHANNELS - 1)
+    #ifndef ADC_CHANNELS
+        #define ADC_CHANNELS 8
+    #endif
+    #if (ADC_CHANNELS < 1) || (ADC_CHANNELS > ROBOLIB_ADC_INPUTS)
+        #error "ADC_CHANNELS exceeds the number of adc inputs"
+    #endif
+
+    // clock of the adc (F_CPU / ADC_PRESCALER)
+    #ifndef ADC_PRESCALER
+        #define ADC_PRESCALER 128
+    #endif
+
+    // reference voltage at startup
+    #ifndef ADC_REFERENCE
+        #define ADC_REFERENCE ADC_REF_AVCC
+    #endif
+
+    // number of conversions, which are dropped after changing the reference
+    #ifndef ADC_REFERENCE_SETTLE
+        #define ADC_REFERENCE_SETTLE 2
+    #endif
+    #if (ADC_REFERENCE_SETTLE < 0) || (ADC_REFERENCE_SETTLE > 255)
+        #error "ADC_REFERENCE_SETTLE must be within 0 .. 255 conversions"
+    #endif
+
+    // names of the timers (see robolib/tick.h)
+    #define TIMER0 0
+    #define TIMER1 1
+
+    // auto trigger of conversions by a timer
+    #ifdef ADC_TRIGGER
+        #if (ADC_TRIGGER != TIMER0) && (ADC_TRIGGER != TIMER1)
+            #error "ADC_TRIGGER must be TIMER0 or TIMER1"
+        #endif
+        #ifndef ADC_TRIGGER_RATE
+            #define ADC_TRIGGER_RATE 1000
+        #endif
+        #if (ADC_TRIGGER_RATE < 1) || (ADC_TRIGGER_RATE > 100000)
+            #error "ADC_TRIGGER_RATE must be within 1 .. 100000 Hz"
+        #endif
+        #define ROBOLIB_RAM_COUNT_ADC_TRIGGER 2
+
+        // noise reduction sleep stops the trigger timer and starts
+        // an additional conversion
+        #ifdef ADC_SLEEP
+            #error "ADC_SLEEP can not be used with ADC_TRIGGER"
+        #endif
+    #else
+        #define ROBOLIB_RAM_COUNT_ADC_TRIGGER 0
+    #endif // #ifdef ADC_TRIGGER
+
+    #ifdef ADC_FILTER
+        #define ROBOLIB_RAM_COUNT_ADC_FILTER (18 * ADC_CHANNELS)
+    #else
+        #define ROBOLIB_RAM_COUNT_ADC_FILTER 0
+    #endif
+
+    #ifdef ADC_OVERSAMPLING
+        #define ROBOLIB_RAM_COUNT_ADC_OVERSAMPLING (4 * ADC_CHANNELS)
+    #else
+        #define ROBOLIB_RAM_COUNT_ADC_OVERSAMPLING 0
+    #endif
+
+    #ifdef ADC_AVERAGE
+        #define ROBOLIB_RAM_COUNT_ADC_AVERAGE \
+          (2 + (3 + 2 * (ADC_AVERAGE)) * ADC_CHANNELS)
+    #else
+        #define ROBOLIB_RAM_COUNT_ADC_AVERAGE 0
+    #endif
+
+    // sums of left adjusted values (up to 65472) would overflow
+    #if defined(ADC_LEFT_ADJUST) && \
+      (defined(ADC_OVERSAMPLING) || defined(ADC_AVERAGE))
+        #error "ADC_LEFT_ADJUST conflicts with ADC_OVERSAMPLING or ADC_AVERAGE"
+    #endif
+
     // for automated initializing see end of this file
 
 #endif // #ifndef doxygen
@@ -32,12 +211,26 @@
 #include <avr/interrupt.h>
 
 //**************************<Types>********************************************
+/// Raw and filtered values of one channel (see adc_filtered_get())
+struct adc_filtered {
+    uint16_t raw;   ///< last measured value
+    uint16_t value; ///< filtered value
+    uint16_t min;   ///< minimal raw value since the last reset
+    uint16_t max;   ///< maximal raw value since the last reset
+};
 
 //**************************<Functions>****************************************
 /**
  * @brief Returns the adc-value of the given channel.
  *
- * This function immediately starts a new adc conversion and returns the result.
+ * This function requests a new adc conversion and waits for the result.
+ * The result of a differential channel is a signed 10-bit value
+ * (two's complement). If ADC_8BIT is defined, all results are
+ * 8-bit values [0..255].
+ * If ADC_SLEEP is defined, the cpu waits in the noise reduction sleep mode.
+ * Be aware that most timers (e.g. a synchronous systick) are stopped
+ * within this sleep mode. Therefore ADC_SLEEP can not be used together
+ * with ADC_TRIGGER.
  *
  * On error this function returns 65535.
  *
@@ -45,15 +238,118 @@
  * but it will enable the global interrupt flag.
  *
  * @param nr
- * ADC-pin number. [0..7, special modes]
+ * Channel descriptor. [0..15, ADC_MUX()]
  *
  * @return
  * ADC-value of the given pin. [0..1023, 65535]
  *
- * @sa adc_buffered_get()
+ * @sa adc_buffered_get(), adc_request()
  */
 uint16_t adc_get(uint8_t nr);
 
+/**
+ * @brief Requests a conversion of the given channel.
+ *
+ * This function adds the given channel to the queue of the adc and
+ * returns immediately. The conversions are handled by the adc interrupt,
+ * which stores the result and starts the next requested channel.
+ * The result can be read with adc_buffer_get() as soon as
+ * adc_is_complete() returns true.
+ *
+ * Channels 0 .. ADC_CHANNELS-1 are buffered. All other channels (e.g. a
+ * differential input selected by ADC_DIFF_X10()) are special channels.
+ * Only one special channel can be requested at once. Its result
+ * can only be read with adc_get().
+ *
+ * This function can be called from within an interrupt.
+ *
+ * @param nr
+ * Channel descriptor. [0..15, ADC_MUX()]
+ *
+ * @return
+ * Boolean value. \n
+ * False (== 0x00) means the request was rejected (e.g. adc is disabled). \n
+ * True  (!= 0x00) means the channel was queued.                          \n
+ *
+ * @sa adc_is_complete(), adc_buffer_get()
+ */
+uint8_t adc_request(uint8_t nr);
+
+/**
+ * @brief Requests conversions of several channels.
+ *
+ * This function adds all channels of the given bit mask to the queue of the
+ * adc and returns immediately (see adc_request()).
+ *
+ * This function can be called from within an interrupt.
+ *
+ * @param mask
+ * Bit mask selecting the ADC-pins. [bit 0..ADC_CHANNELS-1]
+ *
+ * @return
+ * Boolean value. \n
+ * False (== 0x00) means the request was rejected (e.g. adc is disabled). \n
+ * True  (!= 0x00) means the channels were queued.                        \n
+ *
+ * @sa adc_request(), adc_is_complete()
+ */
+uint8_t adc_request_mask(uint16_t mask);
+
+/**
+ * @brief Returns if the requested conversion is complete.
+ *
+ * This function checks if the last requested conversion of the given
+ * channel is finished.
+ *
+ * This function can be called from within an interrupt.
+ *
+ * @param nr
+ * Channel descriptor. [0..15, ADC_MUX()]
+ *
+ * @return
+ * Boolean value. \n
+ * False (== 0x00) means the conversion is still pending. \n
+ * True  (!= 0x00) means the result is available.          \n
+ *
+ * @sa adc_request()
+ */
+uint8_t adc_is_complete(uint8_t nr);
+
+/**
+ * @brief Sets the channels, which are converted by the auto trigger.
+ *
+ * Only available if ADC_TRIGGER is defined.
+ *
+ * The timer selected by ADC_TRIGGER starts one conversion every
+ * 1 / ADC_TRIGGER_RATE seconds - independent of any software latency.
+ * The adc interrupt selects the channel for the next trigger. Requested
+ * channels (see adc_request()) are converted first. If no request is
+ * pending, the channels of this mask are converted one after another.
+ * Their results can be read with adc_buffer_get().
+ *
+ * This function can be called from within an interrupt.
+ *
+ * @param mask
+ * Bit mask selecting the ADC-pins. [bit 0..ADC_CHANNELS-1]
+ *
+ * @sa adc_trigger_mask_get(), adc_buffer_get()
+ */
+void adc_trigger_mask_set(uint16_t mask);
+
+/**
+ * @brief Returns the channels, which are converted by the auto trigger.
+ *
+ * Only available if ADC_TRIGGER is defined.
+ *
+ * This function can be called from within an interrupt.
+ *
+ * @return
+ * Bit mask with the selected ADC-pins.
+ *
+ * @sa adc_trigger_mask_set()
+ */
+uint16_t adc_trigger_mask_get(void);
+
 /**
  * @brief Returns the buffered adc-value of the given channel.
  *
@@ -64,7 +360,7 @@ uint16_t adc_get(uint8_t nr);
  * This function can be called from within an interrupt.
  *
  * @param nr
- * ADC-pin number. [0..7]
+ * ADC-pin number. [0..ADC_CHANNELS-1]
  *
  * @return
  * ADC-value of the given pin. [0..1023, 65535]
@@ -73,6 +369,90 @@ uint16_t adc_get(uint8_t nr);
  */
 uint16_t adc_buffer_get(uint8_t nr);
 
+/**
+ * @brief Sets the oversampling of the given channel.
+ *
+ * Only available if ADC_OVERSAMPLING is defined.
+ *
+ * For n additional bits the adc interrupt sums up 4^n conversions of the
+ * channel and shifts the sum right by n. Only the final result is stored
+ * and reported as complete. Therefore the result ranges up to
+ * 1023 * 2^n and one request takes 4^n conversions.
+ *
+ * This function can be called from within an interrupt.
+ *
+ * @param nr
+ * ADC-pin number. [0..ADC_CHANNELS-1]
+ *
+ * @param bits
+ * Number of additional bits. [0..3]
+ *
+ * @sa adc_oversampling_get()
+ */
+void adc_oversampling_set(uint8_t nr, uint8_t bits);
+
+/**
+ * @brief Returns the oversampling of the given channel.
+ *
+ * Only available if ADC_OVERSAMPLING is defined.
+ *
+ * This function can be called from within an interrupt.
+ *
+ * @param nr
+ * ADC-pin number. [0..ADC_CHANNELS-1]
+ *
+ * @return
+ * Number of additional bits. [0..3]
+ *
+ * @sa adc_oversampling_set()
+ */
+uint8_t adc_oversampling_get(uint8_t nr);
+
+/**
+ * @brief Enables or disables the moving average of the given channel.
+ *
+ * Only available if ADC_AVERAGE is defined.
+ *
+ * The adc interrupt keeps the last ADC_AVERAGE results of the channel
+ * and their sum. When enabled, the buffer is filled with the last
+ * measured value.
+ *
+ * This function can be called from within an interrupt.
+ *
+ * @param nr
+ * ADC-pin number. [0..ADC_CHANNELS-1]
+ *
+ * @param enable
+ * Boolean value. \n
+ * False (== 0x00) disables the moving average. \n
+ * True  (!= 0x00) enables the moving average.  \n
+ *
+ * @sa adc_average_get()
+ */
+void adc_average_set(uint8_t nr, uint8_t enable);
+
+/**
+ * @brief Returns the moving average of the given channel.
+ *
+ * Only available if ADC_AVERAGE is defined.
+ *
+ * If the moving average of the channel is disabled, this function
+ * returns the last measured value (see adc_buffer_get()).
+ *
+ * On error this function returns 65535.
+ *
+ * This function can be called from within an interrupt.
+ *
+ * @param nr
+ * ADC-pin number. [0..ADC_CHANNELS-1]
+ *
+ * @return
+ * Average of the last ADC_AVERAGE values. [0..8184, 65535]
+ *
+ * @sa adc_average_set(), adc_buffer_get()
+ */
+uint16_t adc_average_get(uint8_t nr);
+
 /**
  * @brief Enables the adc modul.
  *
@@ -111,6 +491,192 @@ void adc_disable(void);
  */
 uint8_t adc_is_enabled(void);
 
+/**
+ * @brief Sets the filter of the given channel.
+ *
+ * Only available if ADC_FILTER is defined.
+ *
+ * The filter is calculated by the adc interrupt for each conversion of
+ * the channel. All filters use integer math only with a fixed number of
+ * operations:
+ * + ADC_FILTER_NONE - no filter
+ * + ADC_FILTER_IIR(shift) - exponential smoothing (single pole iir)
+ * + ADC_FILTER_MEDIAN3 - median of the last 3 values
+ * + ADC_FILTER_MEDIAN5 - median of the last 5 values
+ *
+ * Additionally the minimum and the maximum of the raw values are tracked.
+ * Setting the filter restarts it with the last measured value and resets
+ * the minimum and maximum.
+ *
+ * This function can be called from within an interrupt.
+ *
+ * @param nr
+ * ADC-pin number. [0..ADC_CHANNELS-1]
+ *
+ * @param filter
+ * Filter of the channel. [ADC_FILTER_NONE, ADC_FILTER_IIR(1..8),
+ * ADC_FILTER_MEDIAN3, ADC_FILTER_MEDIAN5]
+ *
+ * @sa adc_filter_get(), adc_filtered_get()
+ */
+void adc_filter_set(uint8_t nr, uint8_t filter);
+
+/**
+ * @brief Returns the filter of the given channel.
+ *
+ * Only available if ADC_FILTER is defined.
+ *
+ * This function can be called from within an interrupt.
+ *
+ * @param nr
+ * ADC-pin number. [0..ADC_CHANNELS-1]
+ *
+ * @return
+ * Filter of the channel (see adc_filter_set()).
+ *
+ * @sa adc_filter_set()
+ */
+uint8_t adc_filter_get(uint8_t nr);
+
+/**
+ * @brief Returns the raw and the filtered values of the given channel.
+ *
+ * Only available if ADC_FILTER is defined.
+ *
+ * All values are copied at once, so they belong to the same conversion.
+ *
+ * This function can be called from within an interrupt.
+ *
+ * @param nr
+ * ADC-pin number. [0..ADC_CHANNELS-1]
+ *
+ * @param result
+ * Pointer to the resulting values. [0 = only the filtered value]
+ *
+ * @return
+ * Filtered value of the given pin. [0..1023, 65535]
+ *
+ * @sa adc_filter_set(), adc_filter_minmax_reset()
+ */
+uint16_t adc_filtered_get(uint8_t nr, struct adc_filtered* result);
+
+/**
+ * @brief Resets the minimum and the maximum of the given channel.
+ *
+ * Only available if ADC_FILTER is defined.
+ *
+ * This function can be called from within an interrupt.
+ *
+ * @param nr
+ * ADC-pin number. [0..ADC_CHANNELS-1]
+ *
+ * @sa adc_filtered_get()
+ */
+void adc_filter_minmax_reset(uint8_t nr);
+
+/**
+ * @brief Sets the prescaler of the adc clock.
+ *
+ * The adc needs 13 clock cycles per conversion. For the full resolution
+ * the adc clock should be within 50kHz .. 200kHz (e.g. 128 at 16MHz).
+ * Higher clocks reduce the resolution - e.g. a prescaler of 16 at 16MHz
+ * results in about 76 kSPS, which is fine for 8-bit values (see ADC_8BIT).
+ *
+ * The startup value is set by ADC_PRESCALER (default 128).
+ *
+ * This function can be called from within an interrupt.
+ *
+ * @param prescaler
+ * Division factor. [2, 4, 8, 16, 32, 64, 128]
+ *
+ * @return
+ * Boolean value. \n
+ * False (== 0x00) means the prescaler is not supported. \n
+ * True  (!= 0x00) means the prescaler was set.           \n
+ *
+ * @sa adc_prescaler_get()
+ */
+uint8_t adc_prescaler_set(uint8_t prescaler);
+
+/**
+ * @brief Returns the prescaler of the adc clock.
+ *
+ * This function can be called from within an interrupt.
+ *
+ * @return
+ * Division factor. [2, 4, 8, 16, 32, 64, 128]
+ *
+ * @sa adc_prescaler_set()
+ */
+uint8_t adc_prescaler_get(void);
+
+/**
+ * @brief Sets the reference voltage of the adc.
+ *
+ * After changing the reference, the next ADC_REFERENCE_SETTLE conversions
+ * are dropped, so that the reference can settle (default 2). Be aware that
+ * a large capacitor at AREF may need more time (e.g. about 1ms for 100nF).
+ *
+ * The startup value is set by ADC_REFERENCE (default ADC_REF_AVCC).
+ *
+ * This function can be called from within an interrupt.
+ *
+ * @param reference
+ * Reference voltage. [ADC_REF_AREF, ADC_REF_AVCC, ADC_REF_1V1, ADC_REF_2V56]
+ *
+ * @sa adc_reference_get()
+ */
+void adc_reference_set(uint8_t reference);
+
+/**
+ * @brief Returns the reference voltage of the adc.
+ *
+ * This function can be called from within an interrupt.
+ *
+ * @return
+ * Reference voltage. [ADC_REF_AREF, ADC_REF_AVCC, ADC_REF_1V1, ADC_REF_2V56]
+ *
+ * @sa adc_reference_set()
+ */
+uint8_t adc_reference_get(void);
+
+/**
+ * @brief Enables or disables the left adjusted result.
+ *
+ * If enabled, all values are left adjusted 16-bit values
+ * (adc-value * 64). This has no effect if ADC_8BIT is defined,
+ * since then only the upper 8 bits are read.
+ *
+ * If ADC_OVERSAMPLING or ADC_AVERAGE is defined, left adjusted values
+ * can not be enabled (the sums would overflow).
+ *
+ * The startup value is set by ADC_LEFT_ADJUST.
+ *
+ * This function can be called from within an interrupt.
+ *
+ * @param enable
+ * Boolean value. \n
+ * False (== 0x00) means right adjusted values. [0..1023]  \n
+ * True  (!= 0x00) means left adjusted values.  [0..65472] \n
+ *
+ * @sa adc_left_adjust_get()
+ */
+void adc_left_adjust_set(uint8_t enable);
+
+/**
+ * @brief Returns if the result is left adjusted.
+ *
+ * This function can be called from within an interrupt.
+ *
+ * @return
+ * Boolean value. \n
+ * False (== 0x00) means right adjusted values. \n
+ * True  (!= 0x00) means left adjusted values.  \n
+ *
+ * @sa adc_left_adjust_set()
+ */
+uint8_t adc_left_adjust_get(void);
+
 /**
  * @brief Prints general information about the adc.
  *
@@ -123,6 +689,7 @@ uint8_t adc_is_enabled(void);
  *   channel[0]  : 564
  *   channel[1]  : 65
  *    ...
+ *   pending     : 0b00000100
  * @endcode
  *
  * This function passes the resulting string byte by byte to the
@@ -198,14 +765,7 @@ void robolib_adc_setchannel(uint8_t nr);
  *
  * Do not call this function at all.
  */
-uint8_t robolib_adc_savevalue(void);
-
-/**
- * @brief Internal function.
- *
- * Do not call this function at all.
- */
-uint8_t robolib_adc_wait(void);
+void robolib_adc_trigger_init(void);
 
 
 /**
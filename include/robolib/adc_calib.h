@@ -0,0 +1,279 @@
+/******************************************************************************
+* robolib/adc_calib.h                                                         *
+* ===================                                                         *
+*                                                                             *
+* Version: 1.0.0                                                              *
+* Date   : 19.10.26                                                           *
+* Author : Peter Weissig                                                      *
+*                                                                             *
+* Changelog:                                                                  *
+*   19.10.26(V1.0.0)                                                          *
+*     - first release                                                         *
+*                                                                             *
+* For help or bug report please visit:                                        *
+*   https://github.com/RoboAG/avr_robolib                                     *
+******************************************************************************/
+
+#ifndef _ROBOLIB_ADC_CALIB_H_
+#define _ROBOLIB_ADC_CALIB_H_
+
+//**************************<Macros>*******************************************
+//! The number of bytes the adc calibration modul uses in order to work
+#define ROBOLIB_RAM_COUNT_ADC_CALIB \
+  (ADC_CHANNELS * (5 + 2 * ROBOLIB_ADC_CALIB_TABLE))
+
+//! Calibration mode: value = (raw - offset) * gain / 256
+#define ADC_CALIB_MODE_LINEAR 0x00
+//! Calibration mode: value = table(raw - offset) - linear interpolated
+#define ADC_CALIB_MODE_TABLE  0x01
+
+#ifndef __DOXYGEN__
+
+    // warnings and errors
+    #ifndef _ROBOLIB_ADC_H_
+        #error "robolib/adc.h" has to be included before this file
+    #endif
+    #ifndef _ROBOLIB_EEPROM_H_
+        #error "robolib/eeprom.h" has to be included before this file
+    #endif
+
+    // optional table with ADC_CALIB_TABLE points per channel
+    #ifdef ADC_CALIB_TABLE
+        #if (ADC_CALIB_TABLE < 2) || (ADC_CALIB_TABLE > 65)
+            #error "ADC_CALIB_TABLE must be within 2 .. 65 points"
+        #endif
+        #define ROBOLIB_ADC_CALIB_TABLE ADC_CALIB_TABLE
+
+        // distance of two points (2^shift raw values)
+        #ifndef ADC_CALIB_TABLE_SHIFT
+            #define ADC_CALIB_TABLE_SHIFT 6
+        #endif
+        #if (ADC_CALIB_TABLE_SHIFT < 0) || (ADC_CALIB_TABLE_SHIFT > 14)
+            #error "ADC_CALIB_TABLE_SHIFT must be within 0 .. 14"
+        #endif
+    #else
+        #define ROBOLIB_ADC_CALIB_TABLE 0
+    #endif // #ifdef ADC_CALIB_TABLE
+
+    // for automated initializing see end of this file
+
+#endif // #ifndef doxygen
+
+//**************************<Included files>***********************************
+#include <inttypes.h>
+#include <avr/interrupt.h>
+#include <avr/pgmspace.h>
+
+//**************************<Types>********************************************
+/// Calibration of one adc channel (in flash, eeprom or ram)
+struct adc_calib {
+    uint8_t mode;    ///< ADC_CALIB_MODE_LINEAR or ADC_CALIB_MODE_TABLE
+    int16_t offset;  ///< raw value, which is subtracted first
+    int16_t gain;    ///< gain in 1/256 units per raw value (linear mode)
+    #if defined(ADC_CALIB_TABLE) || defined(__DOXYGEN__)
+        /// values at raw = i * 2^ADC_CALIB_TABLE_SHIFT (table mode)
+        int16_t table[ROBOLIB_ADC_CALIB_TABLE];
+    #endif
+};
+
+//**************************<Functions>****************************************
+/**
+ * @brief Sets the calibration of the given channel.
+ *
+ * The calibration is copied into the ram.
+ * By default each channel uses offset 0 and gain 256 (raw values).
+ *
+ * This function can be called from within an interrupt.
+ *
+ * @param nr
+ * ADC-pin number. [0..ADC_CHANNELS-1]
+ *
+ * @param calib
+ * Pointer to the calibration within the ram.
+ *
+ * @sa adc_calib_load_flash(), adc_calib_load_eeprom(), adc_calib_get()
+ */
+void adc_calib_set(uint8_t nr, const struct adc_calib* calib);
+
+/**
+ * @brief Loads the calibration of the given channel from flash.
+ *
+ * This function copies a calibration, which is stored within the flash
+ * (PROGMEM), into the ram.
+ *
+ * This function can be called from within an interrupt.
+ *
+ * @param nr
+ * ADC-pin number. [0..ADC_CHANNELS-1]
+ *
+ * @param calib
+ * Pointer to the calibration within the flash.
+ *
+ * @sa adc_calib_set()
+ */
+void adc_calib_load_flash(uint8_t nr, const struct adc_calib* calib);
+
+/**
+ * @brief Loads the calibration of all channels from the eeprom.
+ *
+ * This function reads the calibration of all channels (see
+ * adc_calib_save_eeprom()) by the eeprom modul. If the eeprom does not
+ * contain a valid calibration, nothing is changed.
+ *
+ * If ADC_CALIB_EEPROM is defined, this function is called at startup
+ * with ADC_CALIB_EEPROM as adress.
+ *
+ * This function must be handled with care when called from within an interrupt.
+ *
+ * @param adr
+ * Adress of the calibration within the eeprom.
+ *
+ * @return
+ * Boolean value. \n
+ * False (== 0x00) means no valid calibration was found. \n
+ * True  (!= 0x00) means the calibration was loaded.      \n
+ *
+ * @sa adc_calib_save_eeprom()
+ */
+uint8_t adc_calib_load_eeprom(uint16_t adr);
+
+/**
+ * @brief Saves the calibration of all channels into the eeprom.
+ *
+ * This function writes a header (marker, ADC_CHANNELS, ADC_CALIB_TABLE and
+ * ADC_CALIB_TABLE_SHIFT) and the calibration of all channels by the eeprom
+ * modul. This needs 5 + ADC_CHANNELS * (5 + 2 * ADC_CALIB_TABLE) bytes.
+ *
+ * This function must be handled with care when called from within an interrupt.
+ *
+ * @param adr
+ * Adress of the calibration within the eeprom.
+ *
+ * @sa adc_calib_load_eeprom()
+ */
+void adc_calib_save_eeprom(uint16_t adr);
+
+/**
+ * @brief Converts a raw value of the given channel.
+ *
+ * This function calculates the calibrated value with integer math only.
+ * Within the table mode, raw values below the offset return the first
+ * point and raw values behind the last point return the last point.
+ *
+ * This function can be called from within an interrupt.
+ *
+ * @param nr
+ * ADC-pin number. [0..ADC_CHANNELS-1]
+ *
+ * @param raw
+ * Raw value (e.g. of adc_timer_get()).
+ *
+ * @return
+ * Calibrated value. [-32768..32767]
+ *
+ * @sa adc_calib_get()
+ */
+int16_t adc_calib_convert(uint8_t nr, uint16_t raw);
+
+/**
+ * @brief Returns the calibrated value of the given channel.
+ *
+ * This function converts the last measured value of the given channel
+ * (see adc_buffer_get()).
+ *
+ * This function can be called from within an interrupt.
+ *
+ * @param nr
+ * ADC-pin number. [0..ADC_CHANNELS-1]
+ *
+ * @return
+ * Calibrated value. [-32768..32767]
+ *
+ * @sa adc_calib_convert(), adc_calib_set()
+ */
+int16_t adc_calib_get(uint8_t nr);
+
+/**
+ * @brief Prints general information about the adc calibration.
+ *
+ * This function prints all the data related to the adc calibration modul.
+ *
+ * The output is similar to the following: \n
+ * @code
+ * adc_calib:
+ *   channel[0]  : linear   0 1250
+ *   channel[1]  : table    12
+ *    ...
+ * @endcode
+ *
+ * This function passes the resulting string byte by byte to the
+ * output function (e.g. uart0_send()).
+ *
+ * This function must be handled with care when called from within an interrupt.
+ *
+ * @param out
+ * Output function of type "void out(uint8_t)"
+ *
+ * @sa robolib_adc_calib_print_compiled()
+ */
+#ifndef __DOXYGEN__
+    void robolib_adc_calib_print(void (*out)(uint8_t));
+#else
+    void robolib_adc_calib_print(void* out);
+#endif
+
+/**
+ * @brief Prints information about the version of the adc calibration.
+ *
+ * This function prints information about the source file(s)
+ * of this modul at compile time. This inlcude the version of
+ * the main files and important macros.
+ *
+ * The output is similar to the following: \n
+ * @code
+ * robolib/adc_calib/adc_calib.c 19.10.2026 V1.0.0
+ *   TABLE       : 17
+ *    ...
+ * @endcode
+ *
+ * This function passes the resulting string byte by byte to the
+ * output function (e.g. uart0_send()).
+ *
+ * This function must be handled with care when called from within an interrupt.
+ *
+ * @param out
+ * Output function of type "void out(uint8_t)"
+ *
+ * @sa robolib_adc_calib_print()
+ */
+#ifndef __DOXYGEN__
+    void robolib_adc_calib_print_compiled(void (*out)(uint8_t));
+#else
+    void robolib_adc_calib_print_compiled(void* out);
+#endif
+
+
+/**
+ * @brief Internal function.
+ *
+ * Do not call this function at all.
+ */
+void robolib_adc_calib_init(void);
+
+// automated initializing
+#ifndef __DOXYGEN__
+    __inline__ void robolib_adc_calib_init_inline(void) {
+        #ifdef ROBOLIB_INIT
+            ROBOLIB_INIT();
+        #endif
+
+        robolib_adc_calib_init();
+    }
+
+    #undef ROBOLIB_INIT
+    #define ROBOLIB_INIT()     robolib_adc_calib_init_inline()
+    #define robolib_init()     cli(); ROBOLIB_INIT(); sei()
+    #define robolib_init_cli() cli(); ROBOLIB_INIT()
+#endif
+
+#endif // #ifndef _ROBOLIB_ADC_CALIB_H_
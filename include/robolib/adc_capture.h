@@ -0,0 +1,315 @@
+/******************************************************************************
+* robolib/adc_capture.h                                                       *
+* =====================                                                       *
+*                                                                             *
+* Version: 1.0.0                                                              *
+* Date   : 19.10.26                                                           *
+* Author : Peter Weissig                                                      *
+*                                                                             *
+* Changelog:                                                                  *
+*   19.10.26(V1.0.0)                                                          *
+*     - first release                                                         *
+*                                                                             *
+* For help or bug report please visit:                                        *
+*   https://github.com/RoboAG/avr_robolib                                     *
+******************************************************************************/
+
+#ifndef _ROBOLIB_ADC_CAPTURE_H_
+#define _ROBOLIB_ADC_CAPTURE_H_
+
+//**************************<Macros>*******************************************
+//! The number of bytes the adc capture modul uses in order to work
+#define ROBOLIB_RAM_COUNT_ADC_CAPTURE (11 + 5 * ADC_CAPTURE)
+
+#ifndef __DOXYGEN__
+
+    // warnings and errors
+    #ifndef _ROBOLIB_ADC_H_
+        #error "robolib/adc.h" has to be included before this file
+    #endif
+
+    // number of samples within the ring buffer
+    #ifndef ADC_CAPTURE
+        #define ADC_CAPTURE 64
+    #endif
+    #if (ADC_CAPTURE !=   4) && (ADC_CAPTURE !=   8) && \
+        (ADC_CAPTURE !=  16) && (ADC_CAPTURE !=  32) && \
+        (ADC_CAPTURE !=  64) && (ADC_CAPTURE != 128)
+        #error "ADC_CAPTURE must be a power of 2 within 4 .. 128 samples"
+    #endif
+
+    // rate of the capture timer (in Hz)
+    #ifndef ADC_CAPTURE_RATE
+        #define ADC_CAPTURE_RATE 1000
+    #endif
+    #if (ADC_CAPTURE_RATE < 1) || (ADC_CAPTURE_RATE > 50000)
+        #error "ADC_CAPTURE_RATE must be within 1 .. 50000 Hz"
+    #endif
+    // one conversion needs 13 cycles of the adc clock
+    #if ADC_CAPTURE_RATE > F_CPU / ADC_PRESCALER / 13
+        #error "ADC_CAPTURE_RATE exceeds the conversion rate of the adc"
+    #endif
+
+    // for automated adc implementation see end of this file
+
+    // for automated initializing see end of this file
+
+#endif // #ifndef doxygen
+
+//**************************<Included files>***********************************
+#include <inttypes.h>
+#include <avr/interrupt.h>
+
+//**************************<Types>********************************************
+/// One captured adc conversion (5 bytes)
+struct adc_capture_sample {
+    uint16_t time;  ///< number of the trigger (1 / ADC_CAPTURE_RATE seconds)
+    uint8_t  nr;    ///< adc channel [0..ADC_CHANNELS-1]
+    uint16_t value; ///< adc-value
+};
+
+//**************************<Functions>****************************************
+/**
+ * @brief Starts capturing the given channels.
+ *
+ * This function empties the ring buffer and starts the capture timer
+ * (TIMER1). On each compare match of the timer, all selected channels
+ * are requested. The adc interrupt stores each result together with the
+ * number of the trigger into the ring buffer.
+ *
+ * All requested channels must be converted within one period of the timer
+ * (e.g. about 104us per conversion at the default prescaler of 128).
+ * Therefore the rate of all channels together is limited to
+ * F_CPU / ADC_PRESCALER / 13 conversions per second (about 9.6kHz at
+ * 16MHz). Conversions, which are not finished in time, are lost.
+ *
+ * This function can be called from within an interrupt.
+ *
+ * @param mask
+ * Bit mask selecting the ADC-pins. [bit 0..ADC_CHANNELS-1]
+ *
+ * @sa adc_capture_stop(), adc_capture_block_get()
+ */
+void adc_capture_start(uint16_t mask);
+
+/**
+ * @brief Stops capturing.
+ *
+ * This function stops the capture timer. Samples within the ring buffer
+ * are kept and can still be read.
+ *
+ * This function can be called from within an interrupt.
+ *
+ * @sa adc_capture_start()
+ */
+void adc_capture_stop(void);
+
+/**
+ * @brief Returns if the capture is running.
+ *
+ * This function can be called from within an interrupt.
+ *
+ * @return
+ * Boolean value. \n
+ * False (== 0x00) means the capture is stopped. \n
+ * True  (!= 0x00) means the capture is running. \n
+ *
+ * @sa adc_capture_start(), adc_capture_stop()
+ */
+uint8_t adc_capture_is_running(void);
+
+/**
+ * @brief Returns the number of samples within the ring buffer.
+ *
+ * This function can be called from within an interrupt.
+ *
+ * @return
+ * Number of samples. [0..ADC_CAPTURE]
+ *
+ * @sa adc_capture_block_get()
+ */
+uint8_t adc_capture_count_get(void);
+
+/**
+ * @brief Returns the oldest contiguous block of samples.
+ *
+ * This function returns a pointer to the oldest sample within the ring
+ * buffer and the number of samples, which are stored behind each other
+ * in memory. The samples stay valid until they are released by
+ * adc_capture_block_release(). The block can be sent as it is, e.g.:
+ * @code
+ * struct adc_capture_sample* block;
+ * uint8_t count = adc_capture_block_get(&block);
+ * uint8_t* data = (uint8_t*) block;
+ * uint16_t i;
+ * for (i = 0; i < count * sizeof(struct adc_capture_sample); i++) {
+ *     uart0_send(data[i]);
+ * }
+ * adc_capture_block_release(count);
+ * @endcode
+ *
+ * This function can be called from within an interrupt.
+ *
+ * @param block
+ * Pointer, which will be set to the first sample.
+ *
+ * @return
+ * Number of contiguous samples. [0..ADC_CAPTURE]
+ *
+ * @sa adc_capture_block_release()
+ */
+uint8_t adc_capture_block_get(struct adc_capture_sample** block);
+
+/**
+ * @brief Releases the oldest samples.
+ *
+ * This function frees the given number of samples, which were returned
+ * by adc_capture_block_get().
+ *
+ * This function can be called from within an interrupt.
+ *
+ * @param count
+ * Number of samples. [0..ADC_CAPTURE]
+ *
+ * @sa adc_capture_block_get()
+ */
+void adc_capture_block_release(uint8_t count);
+
+/**
+ * @brief Returns the number of lost samples.
+ *
+ * If the ring buffer is full, new samples are dropped and counted.
+ * The counter is reset by adc_capture_start().
+ *
+ * This function can be called from within an interrupt.
+ *
+ * @return
+ * Number of lost samples. [0..65535]
+ *
+ * @sa adc_capture_start()
+ */
+uint16_t adc_capture_lost_get(void);
+
+/**
+ * @brief Prints general information about the adc capture.
+ *
+ * This function prints all the data related to the adc capture modul.
+ *
+ * The output is similar to the following: \n
+ * @code
+ * adc_capture:
+ *   running     : true
+ *   mask        : 0b00000011
+ *   count       : 12
+ *   lost        : 0
+ * @endcode
+ *
+ * This function passes the resulting string byte by byte to the
+ * output function (e.g. uart0_send()).
+ *
+ * This function must be handled with care when called from within an interrupt.
+ *
+ * @param out
+ * Output function of type "void out(uint8_t)"
+ *
+ * @sa robolib_adc_capture_print_compiled()
+ */
+#ifndef __DOXYGEN__
+    void robolib_adc_capture_print(void (*out)(uint8_t));
+#else
+    void robolib_adc_capture_print(void* out);
+#endif
+
+/**
+ * @brief Prints information about the version of the adc capture.
+ *
+ * This function prints information about the source file(s)
+ * of this modul at compile time. This inlcude the version of
+ * the main files and important macros.
+ *
+ * The output is similar to the following: \n
+ * @code
+ * robolib/adc_capture/adc_capture.c 19.10.2026 V1.0.0
+ * robolib/adc_capture/adc_capture_atmega2561.c 19.10.2026 V1.0.0
+ *   MCU         : atmega2561
+ *    ...
+ * @endcode
+ *
+ * This function passes the resulting string byte by byte to the
+ * output function (e.g. uart0_send()).
+ *
+ * This function must be handled with care when called from within an interrupt.
+ *
+ * @param out
+ * Output function of type "void out(uint8_t)"
+ *
+ * @sa robolib_adc_capture_print()
+ */
+#ifndef __DOXYGEN__
+    void robolib_adc_capture_print_compiled(void (*out)(uint8_t));
+#else
+    void robolib_adc_capture_print_compiled(void* out);
+#endif
+
+
+/**
+ * @brief Internal function.
+ *
+ * Do not call this function at all.
+ */
+void robolib_adc_capture_adc(uint8_t nr, uint16_t value);
+
+// automated adc implementation
+#ifndef __DOXYGEN__
+    __inline__ void robolib_adc_capture_adc_inline(uint8_t nr, uint16_t value) {
+        #ifdef ROBOLIB_ADC_FUNCTION
+            ROBOLIB_ADC_FUNCTION(nr, value);
+        #endif
+
+        robolib_adc_capture_adc(nr, value);
+    }
+
+    #undef ROBOLIB_ADC_FUNCTION
+    #define ROBOLIB_ADC_FUNCTION(nr, value) \
+      robolib_adc_capture_adc_inline(nr, value)
+#endif
+
+
+/**
+ * @brief Internal function.
+ *
+ * Do not call this function at all.
+ */
+void robolib_adc_capture_timer_start(void);
+
+/**
+ * @brief Internal function.
+ *
+ * Do not call this function at all.
+ */
+void robolib_adc_capture_timer_stop(void);
+
+/**
+ * @brief Internal function.
+ *
+ * Do not call this function at all.
+ */
+void robolib_adc_capture_init(void);
+
+// automated initializing
+#ifndef __DOXYGEN__
+    __inline__ void robolib_adc_capture_init_inline(void) {
+        #ifdef ROBOLIB_INIT
+            ROBOLIB_INIT();
+        #endif
+
+        robolib_adc_capture_init();
+    }
+
+    #undef ROBOLIB_INIT
+    #define ROBOLIB_INIT()     robolib_adc_capture_init_inline()
+    #define robolib_init()     cli(); ROBOLIB_INIT(); sei()
+    #define robolib_init_cli() cli(); ROBOLIB_INIT()
+#endif
+
+#endif // #ifndef _ROBOLIB_ADC_CAPTURE_H_
@@ -2,13 +2,21 @@
 * robolib/adc_timer.h                                                         *
 * ===================                                                         *
 *                                                                             *
-* Version: 0.0.0                                                              *
-* Date   : 27.09.15                                                           *
+* Version: 0.4.0                                                              *
+* Date   : 19.10.26                                                           *
 * Author : Peter Weissig                                                      *
 *                                                                             *
 * Changelog:                                                                  *
 *   27.09.15(V0.0.0)                                                          *
 *     - first release                                                         *
+*   19.10.26(V0.1.0)                                                          *
+*     - optional scan mode with double buffered sweeps (ADC_TIMER_SCAN)       *
+*   19.10.26(V0.2.0)                                                          *
+*     - 16-bit masks for up to ADC_CHANNELS channels                          *
+*   19.10.26(V0.3.0)                                                          *
+*     - sequence table for constant time channel rotation                     *
+*   19.10.26(V0.4.0)                                                          *
+*     - optional weights per channel (ADC_TIMER_WEIGHTS) and urgent channel   *
 *                                                                             *
 * For help or bug report please visit:                                        *
 *   https://github.com/RoboAG/avr_robolib                                     *
@@ -19,7 +27,14 @@
 
 //**************************<Macros>*******************************************
 //! The number of bytes the adc modul uses in order to work
-#define ROBOLIB_RAM_COUNT_ADC_TIMER 2
+#ifdef ADC_TIMER_SCAN
+    #define ROBOLIB_RAM_COUNT_ADC_TIMER (9 + 4 * ADC_CHANNELS)
+#elif defined(ADC_TIMER_WEIGHTS)
+    #define ROBOLIB_RAM_COUNT_ADC_TIMER \
+      (6 + ADC_CHANNELS + ADC_CHANNELS * ADC_TIMER_WEIGHTS)
+#else
+    #define ROBOLIB_RAM_COUNT_ADC_TIMER (6 + ADC_CHANNELS)
+#endif
 
 #ifndef __DOXYGEN__
 
@@ -28,6 +43,23 @@
         #error "robolib/timer.h" has to be included after this file
     #endif //#ifndef ROBOLIB_SYSTICK
 
+    #ifdef ADC_TIMER_SCAN
+        #if (ADC_TIMER_SCAN < 0) || (ADC_TIMER_SCAN > 255)
+            #error "ADC_TIMER_SCAN must be within 0 .. 255 ticks"
+        #endif
+    #endif // #ifdef ADC_TIMER_SCAN
+
+    #ifdef ADC_TIMER_WEIGHTS
+        #ifdef ADC_TIMER_SCAN
+            #error "ADC_TIMER_WEIGHTS can not be used with ADC_TIMER_SCAN"
+        #endif
+        #if (ADC_TIMER_WEIGHTS < 2) || (ADC_TIMER_WEIGHTS > 15)
+            #error "ADC_TIMER_WEIGHTS must be within 2 .. 15"
+        #endif
+    #endif // #ifdef ADC_TIMER_WEIGHTS
+
+    // for automated adc implementation see end of this file
+
 
     // for automated systick implementation see end of this file
 
@@ -47,22 +79,42 @@
  *
  * This function returns the last measured value of the given adc-channel.
  *
+ * If ADC_TIMER_SCAN is defined, all selected channels are measured
+ * back-to-back within one sweep. The values are double buffered, so
+ * all returned values belong to the last completed sweep.
+ *
  * This function can be called from within an interrupt.
  *
  * @param nr
- * ADC-pin number. [0..7]
+ * ADC-pin number. [0..ADC_CHANNELS-1]
  *
  * @return
  * ADC-value of the given pin. [0..1023]
  *
  * @sa adc_timer_mask_set(), adc_timer_get_direct()
  */
-#ifndef __DOXYGEN__
+#if !defined(__DOXYGEN__) && !defined(ADC_TIMER_SCAN)
     #define adc_timer_get(nr) adc_buffer_get(nr)
 #else
     uint16_t adc_timer_get(uint8_t nr);
 #endif
 
+/**
+ * @brief Returns the number of completed sweeps.
+ *
+ * This function returns a counter, which is incremented each time a sweep
+ * over all selected channels is completed (see ADC_TIMER_SCAN).
+ * It can be used to check if new values are available.
+ *
+ * This function can be called from within an interrupt.
+ *
+ * @return
+ * Number of sweeps. [0..65535]
+ *
+ * @sa adc_timer_get()
+ */
+uint16_t adc_timer_sweeps_get(void);
+
 /**
  * @brief Changes the bit-mask of the adc.
  *
@@ -71,14 +123,17 @@
  * continuously measured.                                                    \n
  * For each cleard bit (== 0) the corresponding pin will not be considered.  \n
  *
+ * The order of the selected channels is stored within a table, so the
+ * systick only needs one lookup for the next channel.
+ *
  * This function can be called from within an interrupt.
  *
  * @param mask
- * Bit mask selecting the ADC-pins.
+ * Bit mask selecting the ADC-pins. [bit 0..ADC_CHANNELS-1]
  *
  * @sa adc_timer_mask_set(), adc_timer_pin_add(), adc_timer_pin_remove()
  */
-void adc_timer_mask_set(uint8_t mask);
+void adc_timer_mask_set(uint16_t mask);
 
 /**
  * @brief Returns the bit-mask of the adc.
@@ -95,7 +150,7 @@ void adc_timer_mask_set(uint8_t mask);
  * @sa adc_timer_mask_set(), adc_timer_pin_add(),
  *     adc_timer_pin_remove()
  */
-uint8_t adc_timer_mask_get(void);
+uint16_t adc_timer_mask_get(void);
 
 /**
  * @brief Adds a pin to the adc mask.
@@ -106,7 +161,7 @@ uint8_t adc_timer_mask_get(void);
  * This function can be called from within an interrupt.
  *
  * @param nr
- * ADC-pin number. [0..7]
+ * ADC-pin number. [0..ADC_CHANNELS-1]
  *
  * @sa adc_timer_pin_remove(), adc_timer_mask_set(), adc_timer_mask_get()
  */
@@ -121,12 +176,73 @@ void adc_timer_pin_add(uint8_t nr);
  * This function can be called from within an interrupt.
  *
  * @param nr
- * ADC-pin number. [0..7]
+ * ADC-pin number. [0..ADC_CHANNELS-1]
  *
  * @sa adc_timer_pin_add(), adc_timer_mask_set(), adc_timer_mask_get()
  */
 void adc_timer_pin_remove(uint8_t nr);
 
+/**
+ * @brief Sets the weight of the given channel.
+ *
+ * Each selected channel is converted as often as its weight within one
+ * round of the rotation - e.g. line sensors with weight 15 and the
+ * battery voltage with weight 1. The conversions of each channel are
+ * spread evenly over the round. The order is precomputed, so the systick
+ * still needs only one lookup for the next channel.
+ *
+ * This function is only available, if ADC_TIMER_WEIGHTS is defined.
+ * By default each channel has the weight 1.
+ *
+ * This function can be called from within an interrupt.
+ *
+ * @param nr
+ * ADC-pin number. [0..ADC_CHANNELS-1]
+ *
+ * @param weight
+ * Number of conversions per round. [1..ADC_TIMER_WEIGHTS]
+ *
+ * @sa adc_timer_weight_get(), adc_timer_mask_set()
+ */
+void adc_timer_weight_set(uint8_t nr, uint8_t weight);
+
+/**
+ * @brief Returns the weight of the given channel.
+ *
+ * This function is only available, if ADC_TIMER_WEIGHTS is defined.
+ *
+ * This function can be called from within an interrupt.
+ *
+ * @param nr
+ * ADC-pin number. [0..ADC_CHANNELS-1]
+ *
+ * @return
+ * Number of conversions per round. [1..ADC_TIMER_WEIGHTS] \n
+ * 0 is returned, if nr is not valid.
+ *
+ * @sa adc_timer_weight_set()
+ */
+uint8_t adc_timer_weight_get(uint8_t nr);
+
+/**
+ * @brief Converts the given channel with the next tick.
+ *
+ * The given channel preempts the rotation - it is requested with the next
+ * tick and afterwards the rotation continues. The channel does not need
+ * to be selected within the mask. Only one channel can be pending; a new
+ * call replaces the last one.
+ *
+ * This function is not available, if ADC_TIMER_SCAN is defined.
+ *
+ * This function can be called from within an interrupt.
+ *
+ * @param nr
+ * ADC-pin number. [0..ADC_CHANNELS-1]
+ *
+ * @sa adc_timer_mask_set()
+ */
+void adc_timer_urgent(uint8_t nr);
+
 /**
  * @brief Prints general information about the adc timer.
  *
@@ -137,6 +253,7 @@ void adc_timer_pin_remove(uint8_t nr);
  * adc timer:
  *   mask        : 0b00011110
  *   next        : 3
+ *   sweeps      : 1234
  *    ...
  * @endcode
  *
@@ -197,18 +314,47 @@ void robolib_adc_timer_tick(void);
 
 // automated systick implementation
 #ifndef __DOXYGEN__
+    // number of this hook (see robolib_tick_print())
+    #define ROBOLIB_TICK_HOOK_ADC_TIMER 2
+    void robolib_tick_hook_done(uint8_t hook);
+
     __inline__ void robolib_adc_timer_tick_inline(void) {
         #ifdef ROBOLIB_TICK_FUNCTION
             ROBOLIB_TICK_FUNCTION();
         #endif
 
         robolib_adc_timer_tick();
+        robolib_tick_hook_done(ROBOLIB_TICK_HOOK_ADC_TIMER);
     }
 
+    #undef ROBOLIB_TICK_FUNCTION
     #define ROBOLIB_TICK_FUNCTION() robolib_adc_timer_tick_inline()
 #endif
 
 
+/**
+ * @brief Internal function.
+ *
+ * Do not call this function at all.
+ */
+void robolib_adc_timer_adc(uint8_t nr, uint16_t value);
+
+// automated adc implementation
+#if !defined(__DOXYGEN__) && defined(ADC_TIMER_SCAN)
+    __inline__ void robolib_adc_timer_adc_inline(uint8_t nr, uint16_t value) {
+        #ifdef ROBOLIB_ADC_FUNCTION
+            ROBOLIB_ADC_FUNCTION(nr, value);
+        #endif
+
+        robolib_adc_timer_adc(nr, value);
+    }
+
+    #undef ROBOLIB_ADC_FUNCTION
+    #define ROBOLIB_ADC_FUNCTION(nr, value) \
+      robolib_adc_timer_adc_inline(nr, value)
+#endif
+
+
 /**
  * @brief Internal function.
  *
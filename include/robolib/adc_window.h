@@ -0,0 +1,282 @@
+/******************************************************************************
+* robolib/adc_window.h                                                        *
+* ====================                                                        *
+*                                                                             *
+* Version: 1.0.0                                                              *
+* Date   : 19.10.26                                                           *
+* Author : Peter Weissig                                                      *
+*                                                                             *
+* Changelog:                                                                  *
+*   19.10.26(V1.0.0)                                                          *
+*     - first release                                                         *
+*                                                                             *
+* For help or bug report please visit:                                        *
+*   https://github.com/RoboAG/avr_robolib                                     *
+******************************************************************************/
+
+#ifndef _ROBOLIB_ADC_WINDOW_H_
+#define _ROBOLIB_ADC_WINDOW_H_
+
+//**************************<Macros>*******************************************
+//! The number of bytes the adc window modul uses in order to work
+#define ROBOLIB_RAM_COUNT_ADC_WINDOW (6 + 12 * ADC_CHANNELS)
+
+//! State of a channel: value is within the window
+#define ADC_WINDOW_INSIDE 0x00
+//! State of a channel: value is below the lower threshold
+#define ADC_WINDOW_BELOW  0x01
+//! State of a channel: value is above the upper threshold
+#define ADC_WINDOW_ABOVE  0x02
+
+#ifndef __DOXYGEN__
+
+    // warnings and errors
+    #ifndef _ROBOLIB_ADC_H_
+        #error "robolib/adc.h" has to be included before this file
+    #endif
+    #ifndef _ROBOLIB_TICK_H_
+        #error "robolib/tick.h" has to be included before this file
+    #endif
+
+    // for automated adc implementation see end of this file
+
+    // for automated initializing see end of this file
+
+#endif // #ifndef doxygen
+
+//**************************<Included files>***********************************
+#include <inttypes.h>
+#include <avr/interrupt.h>
+
+//**************************<Types>********************************************
+/// Last crossing of a window (5 bytes)
+struct adc_window_event {
+    uint8_t  state; ///< new state (e.g. ADC_WINDOW_BELOW)
+    uint16_t value; ///< adc-value, which caused the crossing
+    uint16_t time;  ///< time of the crossing (see tick_get())
+};
+
+//**************************<Functions>****************************************
+/**
+ * @brief Sets the window of the given channel.
+ *
+ * Each conversion of the channel is compared within the adc interrupt.
+ * If the value drops below the lower threshold or rises above the upper
+ * threshold, an event is raised. The value has to return by the given
+ * hysteresis into the window, before the state changes back to
+ * ADC_WINDOW_INSIDE (which raises an event, too).
+ *
+ * The state is reset to ADC_WINDOW_INSIDE and pending events of the
+ * channel are cleared.
+ *
+ * This function can be called from within an interrupt.
+ *
+ * @param nr
+ * ADC-pin number. [0..ADC_CHANNELS-1]
+ *
+ * @param low
+ * Lower threshold. [0..1023]
+ *
+ * @param high
+ * Upper threshold. [0..1023]
+ *
+ * @param hysteresis
+ * Hysteresis for returning into the window. [0..1023]
+ *
+ * @sa adc_window_clear(), adc_window_event_get()
+ */
+void adc_window_set(uint8_t nr, uint16_t low, uint16_t high,
+  uint16_t hysteresis);
+
+/**
+ * @brief Disables the window of the given channel.
+ *
+ * Pending events of the channel are cleared.
+ *
+ * This function can be called from within an interrupt.
+ *
+ * @param nr
+ * ADC-pin number. [0..ADC_CHANNELS-1]
+ *
+ * @sa adc_window_set()
+ */
+void adc_window_clear(uint8_t nr);
+
+/**
+ * @brief Returns the current state of the given channel.
+ *
+ * This function can be called from within an interrupt.
+ *
+ * @param nr
+ * ADC-pin number. [0..ADC_CHANNELS-1]
+ *
+ * @return
+ * ADC_WINDOW_INSIDE, ADC_WINDOW_BELOW or ADC_WINDOW_ABOVE
+ *
+ * @sa adc_window_set()
+ */
+uint8_t adc_window_state_get(uint8_t nr);
+
+/**
+ * @brief Returns all channels with pending events.
+ *
+ * The main loop only needs to check this mask instead of reading each
+ * channel.
+ *
+ * This function can be called from within an interrupt.
+ *
+ * @return
+ * Bit mask of the ADC-pins with pending events. [bit 0..ADC_CHANNELS-1]
+ *
+ * @sa adc_window_event_get()
+ */
+uint16_t adc_window_events_get(void);
+
+/**
+ * @brief Returns and clears the last event of the given channel.
+ *
+ * If several crossings happened since the last call, only the last one
+ * is returned.
+ *
+ * This function can be called from within an interrupt.
+ *
+ * @param nr
+ * ADC-pin number. [0..ADC_CHANNELS-1]
+ *
+ * @param event
+ * Pointer, which will be filled with the event (may be 0).
+ *
+ * @return
+ * Boolean value. \n
+ * False (== 0x00) means no event was pending. \n
+ * True  (!= 0x00) means an event was returned. \n
+ *
+ * @sa adc_window_events_get()
+ */
+uint8_t adc_window_event_get(uint8_t nr, struct adc_window_event* event);
+
+/**
+ * @brief Sets the function, which is called on each crossing.
+ *
+ * The callback is called from within the adc interrupt - it should return
+ * as fast as possible. Events are raised nevertheless.
+ *
+ * This function can be called from within an interrupt.
+ *
+ * @param callback
+ * Function of type "void callback(uint8_t nr, uint8_t state)" or 0.
+ *
+ * @sa adc_window_set()
+ */
+#ifndef __DOXYGEN__
+    void adc_window_callback_set(void (*callback)(uint8_t, uint8_t));
+#else
+    void adc_window_callback_set(void* callback);
+#endif
+
+/**
+ * @brief Prints general information about the adc window.
+ *
+ * This function prints all the data related to the adc window modul.
+ *
+ * The output is similar to the following: \n
+ * @code
+ * adc_window:
+ *   events      : 0b00000100
+ *   channel[2]  : 100 900 10 below
+ *    ...
+ * @endcode
+ *
+ * This function passes the resulting string byte by byte to the
+ * output function (e.g. uart0_send()).
+ *
+ * This function must be handled with care when called from within an interrupt.
+ *
+ * @param out
+ * Output function of type "void out(uint8_t)"
+ *
+ * @sa robolib_adc_window_print_compiled()
+ */
+#ifndef __DOXYGEN__
+    void robolib_adc_window_print(void (*out)(uint8_t));
+#else
+    void robolib_adc_window_print(void* out);
+#endif
+
+/**
+ * @brief Prints information about the version of the adc window.
+ *
+ * This function prints information about the source file(s)
+ * of this modul at compile time. This inlcude the version of
+ * the main files and important macros.
+ *
+ * The output is similar to the following: \n
+ * @code
+ * robolib/adc_window/adc_window.c 19.10.2026 V1.0.0
+ *    ...
+ * @endcode
+ *
+ * This function passes the resulting string byte by byte to the
+ * output function (e.g. uart0_send()).
+ *
+ * This function must be handled with care when called from within an interrupt.
+ *
+ * @param out
+ * Output function of type "void out(uint8_t)"
+ *
+ * @sa robolib_adc_window_print()
+ */
+#ifndef __DOXYGEN__
+    void robolib_adc_window_print_compiled(void (*out)(uint8_t));
+#else
+    void robolib_adc_window_print_compiled(void* out);
+#endif
+
+
+/**
+ * @brief Internal function.
+ *
+ * Do not call this function at all.
+ */
+void robolib_adc_window_adc(uint8_t nr, uint16_t value);
+
+// automated adc implementation
+#ifndef __DOXYGEN__
+    __inline__ void robolib_adc_window_adc_inline(uint8_t nr, uint16_t value) {
+        #ifdef ROBOLIB_ADC_FUNCTION
+            ROBOLIB_ADC_FUNCTION(nr, value);
+        #endif
+
+        robolib_adc_window_adc(nr, value);
+    }
+
+    #undef ROBOLIB_ADC_FUNCTION
+    #define ROBOLIB_ADC_FUNCTION(nr, value) \
+      robolib_adc_window_adc_inline(nr, value)
+#endif
+
+
+/**
+ * @brief Internal function.
+ *
+ * Do not call this function at all.
+ */
+void robolib_adc_window_init(void);
+
+// automated initializing
+#ifndef __DOXYGEN__
+    __inline__ void robolib_adc_window_init_inline(void) {
+        #ifdef ROBOLIB_INIT
+            ROBOLIB_INIT();
+        #endif
+
+        robolib_adc_window_init();
+    }
+
+    #undef ROBOLIB_INIT
+    #define ROBOLIB_INIT()     robolib_adc_window_init_inline()
+    #define robolib_init()     cli(); ROBOLIB_INIT(); sei()
+    #define robolib_init_cli() cli(); ROBOLIB_INIT()
+#endif
+
+#endif // #ifndef _ROBOLIB_ADC_WINDOW_H_
@@ -2,13 +2,15 @@
 * robolib/delay.h                                                             *
 * ===============                                                             *
 *                                                                             *
-* Version: 1.0.0                                                              *
-* Date   : 27.09.15                                                           *
+* Version: 1.1.0                                                              *
+* Date   : 19.10.26                                                           *
 * Author : Peter Weissig                                                      *
 *                                                                             *
 * Changelog:                                                                  *
 *   27.09.15(V1.0.0)                                                          *
 *     - first release                                                         *
+*   19.10.26(V1.1.0)                                                          *
+*     - cycle exact inline delays for constant arguments                      *
 *                                                                             *
 * For help or bug report please visit:                                        *
 *   https://github.com/RoboAG/avr_robolib                                     *
@@ -85,6 +87,75 @@ void delay_ms(uint16_t mseconds);
  */
 void delay_us(uint16_t useconds);
 
+/**
+ * @brief Waits for exactly the given number of cpu cycles.
+ *
+ * This macro is expanded by the compiler to a sequence of loops and nops
+ * (__builtin_avr_delay_cycles). There is no call overhead - e.g. for short
+ * pulses of bit-banged protocols.
+ *
+ * The argument must be a compile time constant.
+ *
+ * This macro can be called from within an interrupt.
+ *
+ * @param cycles
+ * Number of cpu cycles. [0..4294967295]
+ *
+ * @sa delay_us_inline(), delay_ms_inline()
+ */
+#define delay_cycles(cycles) __builtin_avr_delay_cycles(cycles)
+
+/**
+ * @brief Waits for mseconds milliseconds - cycle exact for constants.
+ *
+ * If mseconds is a compile time constant, this macro waits for exactly
+ * the corresponding number of cpu cycles (see delay_cycles()).
+ * Otherwise delay_ms() is called.
+ *
+ * This macro can be called from within an interrupt.
+ *
+ * @param mseconds
+ * Time-period in milliseconds.
+ *
+ * @sa delay_ms(), delay_cycles()
+ */
+#define delay_ms_inline(mseconds) \
+  do { \
+      if (__builtin_constant_p(mseconds)) { \
+          delay_cycles((uint32_t) \
+            (((uint64_t) F_CPU * (mseconds) + 999) / 1000)); \
+      } else { \
+          delay_ms(mseconds); \
+      } \
+  } while (0)
+
+/**
+ * @brief Waits for 10x useconds microseconds - cycle exact for constants.
+ *
+ * The time-period in microseconds is always 10 times higher than
+ * useconds (same as delay_us()).
+ *
+ * If useconds is a compile time constant, this macro waits for exactly
+ * the corresponding number of cpu cycles (see delay_cycles()).
+ * Otherwise delay_us() is called.
+ *
+ * This macro can be called from within an interrupt.
+ *
+ * @param useconds
+ * Time-period in 10x microseconds.
+ *
+ * @sa delay_us(), delay_cycles()
+ */
+#define delay_us_inline(useconds) \
+  do { \
+      if (__builtin_constant_p(useconds)) { \
+          delay_cycles((uint32_t) \
+            (((uint64_t) F_CPU * (useconds) + 99999) / 100000)); \
+      } else { \
+          delay_us(useconds); \
+      } \
+  } while (0)
+
 /**
  * @brief Prints general information about the delay.
  *
@@ -2,13 +2,22 @@
 * robolib/display.h                                                           *
 * =================                                                           *
 *                                                                             *
-* Version: 1.0.0                                                              *
-* Date   : 27.09.15                                                           *
+* Version: 1.4.0                                                              *
+* Date   : 19.10.26                                                           *
 * Author : Peter Weissig                                                      *
 *                                                                             *
 * Changelog:                                                                  *
 *   27.09.15(V1.0.0)                                                          *
 *     - first release                                                         *
+*   19.10.26(V1.1.0)                                                          *
+*     - optional interrupt driven output with a queue (DISPLAY_ASYNC)         *
+*   19.10.26(V1.2.0)                                                          *
+*     - optional 8-bit data bus (DISPLAY_DATA_8BIT)                           *
+*   19.10.26(V1.3.0)                                                          *
+*     - optional write-only mode without RW pin (DISPLAY_NO_RW)               *
+*   19.10.26(V1.4.0)                                                          *
+*     - display geometry (DISPLAY_WIDTH, DISPLAY_HEIGHT) up to 40x4           *
+*     - optional second controller (DISPLAY_PIN_E2)                           *
 *                                                                             *
 * For help or bug report please visit:                                        *
 *   https://github.com/RoboAG/avr_robolib                                     *
@@ -40,14 +49,24 @@
         #define DISPLAY_PIN_RS 5
     #endif // #ifndef DISPLAY_PIN_RS
 
-    #ifndef DISPLAY_PIN_RW
-        #define DISPLAY_PIN_RW 6
-    #endif // #ifndef DISPLAY_PIN_RW
+    #ifdef DISPLAY_NO_RW
+        #ifdef DISPLAY_PIN_RW
+            #error "DISPLAY_PIN_RW can not be used with DISPLAY_NO_RW"
+        #endif
+    #else
+        #ifndef DISPLAY_PIN_RW
+            #define DISPLAY_PIN_RW 6
+        #endif // #ifndef DISPLAY_PIN_RW
+    #endif // #ifdef DISPLAY_NO_RW
 
     //
     // display port for data
     //
     #ifndef DISPLAY_DATA_PORT
+        // 8-bit data bus uses the whole port (control pins are elsewhere)
+        #ifdef DISPLAY_DATA_8BIT
+            #error "DISPLAY_DATA_8BIT needs an other DISPLAY_DATA_PORT"
+        #endif
         #define DISPLAY_DATA_PORT DISPLAY_PORT
     #endif // ifndef DISPLAY_PORT
 
@@ -55,7 +74,14 @@
     #define ROBOLIB_DISPLAY_DATA_PIN  ROBOLIB_PIN_CREATE( DISPLAY_DATA_PORT)
     #define ROBOLIB_DISPLAY_DATA_DDR  ROBOLIB_DDR_CREATE( DISPLAY_DATA_PORT)
 
-    #ifdef DISPLAY_DATA_HI
+    #if defined(DISPLAY_DATA_8BIT)
+        #define ROBOLIB_DISPLAY_BUSY_GET()    (ROBOLIB_DISPLAY_DATA_PIN &  0x80)
+        #define ROBOLIB_DISPLAY_DATA_DDR_R()  (ROBOLIB_DISPLAY_DATA_DDR =  0x00)
+        #define ROBOLIB_DISPLAY_DATA_DDR_W()  (ROBOLIB_DISPLAY_DATA_DDR =  0xFF)
+        #define ROBOLIB_DISPLAY_DATA_GET()    (ROBOLIB_DISPLAY_DATA_PIN        )
+        #define ROBOLIB_DISPLAY_DATA_SET(x)   (ROBOLIB_DISPLAY_DATA_PORT = (x))
+        #define ROBOLIB_DISPLAY_DATA_SET_0()  (ROBOLIB_DISPLAY_DATA_PORT = 0x00)
+    #elif defined(DISPLAY_DATA_HI)
         #define ROBOLIB_DISPLAY_BUSY_GET()    (ROBOLIB_DISPLAY_DATA_PIN &  0x80)
         #define ROBOLIB_DISPLAY_DATA_DDR_R()  (ROBOLIB_DISPLAY_DATA_DDR&= ~0xF0)
         #define ROBOLIB_DISPLAY_DATA_DDR_W()  (ROBOLIB_DISPLAY_DATA_DDR|=  0xF0)
@@ -67,7 +93,7 @@
           (ROBOLIB_DISPLAY_DATA_PORT & 0x0F) |(x & 0xF0))
         #define ROBOLIB_DISPLAY_DATA_SET_0()  (ROBOLIB_DISPLAY_DATA_PORT = \
           (ROBOLIB_DISPLAY_DATA_PORT & 0x0F))
-    #else // #ifdef DISPLAY_DATA_HI
+    #else // #if defined(DISPLAY_DATA_8BIT)
         #define ROBOLIB_DISPLAY_BUSY_GET()    (ROBOLIB_DISPLAY_DATA_PIN &  0x08)
         #define ROBOLIB_DISPLAY_DATA_DDR_R()  (ROBOLIB_DISPLAY_DATA_DDR&= ~0x0F)
         #define ROBOLIB_DISPLAY_DATA_DDR_W()  (ROBOLIB_DISPLAY_DATA_DDR|=  0x0F)
@@ -79,14 +105,30 @@
           (ROBOLIB_DISPLAY_DATA_PORT & 0xF0) |(x >>   4))
         #define ROBOLIB_DISPLAY_DATA_SET_0()  (ROBOLIB_DISPLAY_DATA_PORT = \
           (ROBOLIB_DISPLAY_DATA_PORT & 0xF0))
-    #endif // #ifdef DISPLAY_DATA_HI
-
-    #define ROBOLIB_DISPLAY_PIN_SET_E(x)  (x ? (ROBOLIB_DISPLAY_PORT|= \
-      _BV(DISPLAY_PIN_E )): (ROBOLIB_DISPLAY_PORT&= ~_BV(DISPLAY_PIN_E )))
+    #endif // #if defined(DISPLAY_DATA_8BIT)
+
+    #ifdef DISPLAY_PIN_E2
+        // selected controller(s) - see robolib_display_e within display.c
+        #define ROBOLIB_DISPLAY_PIN_SET_E(x)  (x ? (ROBOLIB_DISPLAY_PORT|= \
+          robolib_display_e): (ROBOLIB_DISPLAY_PORT&= ~robolib_display_e))
+        #define ROBOLIB_DISPLAY_MASK_E        \
+          (_BV(DISPLAY_PIN_E) | _BV(DISPLAY_PIN_E2))
+    #else
+        #define ROBOLIB_DISPLAY_PIN_SET_E(x)  (x ? (ROBOLIB_DISPLAY_PORT|= \
+          _BV(DISPLAY_PIN_E )): (ROBOLIB_DISPLAY_PORT&= ~_BV(DISPLAY_PIN_E )))
+        #define ROBOLIB_DISPLAY_MASK_E        _BV(DISPLAY_PIN_E)
+    #endif
     #define ROBOLIB_DISPLAY_PIN_SET_RS(x) (x ? (ROBOLIB_DISPLAY_PORT|= \
       _BV(DISPLAY_PIN_RS)): (ROBOLIB_DISPLAY_PORT&= ~_BV(DISPLAY_PIN_RS)))
-    #define ROBOLIB_DISPLAY_PIN_SET_RW(x) (x ? (ROBOLIB_DISPLAY_PORT|= \
-      _BV(DISPLAY_PIN_RW)): (ROBOLIB_DISPLAY_PORT&= ~_BV(DISPLAY_PIN_RW)))
+    #ifdef DISPLAY_NO_RW
+        // RW is connected to ground (write only)
+        #define ROBOLIB_DISPLAY_PIN_SET_RW(x) ((void) 0)
+        #define ROBOLIB_DISPLAY_MASK_RW       0x00
+    #else
+        #define ROBOLIB_DISPLAY_PIN_SET_RW(x) (x ? (ROBOLIB_DISPLAY_PORT|= \
+          _BV(DISPLAY_PIN_RW)): (ROBOLIB_DISPLAY_PORT&= ~_BV(DISPLAY_PIN_RW)))
+        #define ROBOLIB_DISPLAY_MASK_RW       _BV(DISPLAY_PIN_RW)
+    #endif
 
     // warnings and errors
     #if (DISPLAY_PIN_E  < 0) || (7 < DISPLAY_PIN_E )
@@ -97,6 +139,7 @@
         #error "DISPLAY_PIN_RS must be between 0 and 7"
     #endif // #if (DISPLAY_PIN_RS < 0) || (7 < DISPLAY_PIN_RS)
 
+    #ifndef DISPLAY_NO_RW
     #if (DISPLAY_PIN_RW < 0) || (7 < DISPLAY_PIN_RW)
         #error "DISPLAY_PIN_RW must be between 0 and 7"
     #endif // #if (DISPLAY_PIN_Rw < 0) || (7 < DISPLAY_PIN_RW)
@@ -112,6 +155,100 @@
     #if DISPLAY_PIN_RS == DISPLAY_PIN_RW
         #error "DISPLAY_PIN_RS and DISPLAY_PIN_RW must not be euqal"
     #endif // #if DISPLAY_PIN_RS = DISPLAY_PIN_RW
+    #endif // #ifndef DISPLAY_NO_RW
+
+    #ifdef DISPLAY_PIN_E2
+    #if (DISPLAY_PIN_E2 < 0) || (7 < DISPLAY_PIN_E2)
+        #error "DISPLAY_PIN_E2 must be between 0 and 7"
+    #endif // #if (DISPLAY_PIN_E2 < 0) || (7 < DISPLAY_PIN_E2)
+
+    #if (DISPLAY_PIN_E2 == DISPLAY_PIN_E) || (DISPLAY_PIN_E2 == DISPLAY_PIN_RS)
+        #error "DISPLAY_PIN_E2 must not be equal to DISPLAY_PIN_E or _RS"
+    #endif
+
+    #if !defined(DISPLAY_NO_RW) && (DISPLAY_PIN_E2 == DISPLAY_PIN_RW)
+        #error "DISPLAY_PIN_E2 and DISPLAY_PIN_RW must not be equal"
+    #endif
+    #endif // #ifdef DISPLAY_PIN_E2
+
+    //
+    // display geometry
+    //
+    #ifndef DISPLAY_WIDTH
+        #define DISPLAY_WIDTH 16
+    #endif // #ifndef DISPLAY_WIDTH
+
+    #ifndef DISPLAY_HEIGHT
+        #if (DISPLAY_WIDTH == 24) || \
+          ((DISPLAY_WIDTH == 40) && !defined(DISPLAY_PIN_E2))
+            #define DISPLAY_HEIGHT 2
+        #else
+            #define DISPLAY_HEIGHT 4
+        #endif
+    #endif // #ifndef DISPLAY_HEIGHT
+
+    #if (DISPLAY_WIDTH != 8) && (DISPLAY_WIDTH != 16) && \
+        (DISPLAY_WIDTH != 20) && (DISPLAY_WIDTH != 24) && (DISPLAY_WIDTH != 40)
+        #error "DISPLAY_WIDTH must be 8, 16, 20, 24 or 40"
+    #endif
+
+    #if (DISPLAY_HEIGHT < 1) || (4 < DISPLAY_HEIGHT)
+        #error "DISPLAY_HEIGHT must be between 1 and 4"
+    #endif
+
+    #if ((DISPLAY_WIDTH == 24) || (DISPLAY_WIDTH == 40)) && \
+      (DISPLAY_HEIGHT > 2) && !defined(DISPLAY_PIN_E2)
+        #error "DISPLAY_PIN_E2 is needed for 4 rows with 24 or 40 columns"
+    #endif
+
+    #if defined(DISPLAY_PIN_E2) && \
+      ((DISPLAY_WIDTH != 40) || (DISPLAY_HEIGHT != 4))
+        #error "DISPLAY_PIN_E2 can only be used with 40x4 displays"
+    #endif
+
+    #if defined(DISPLAY_DATA_8BIT) && defined(DISPLAY_DATA_HI)
+        #error "DISPLAY_DATA_HI can not be used with DISPLAY_DATA_8BIT"
+    #endif
+
+    // optional queue, which is written to the display by the systick
+    #ifdef DISPLAY_ASYNC
+        #ifndef _ROBOLIB_TICK_H_
+            #error "robolib/tick.h" has to be included before this file
+        #endif
+
+        #if (DISPLAY_ASYNC !=   8) && (DISPLAY_ASYNC !=  16) && \
+            (DISPLAY_ASYNC !=  32) && (DISPLAY_ASYNC !=  64) && \
+            (DISPLAY_ASYNC != 128)
+            #error "DISPLAY_ASYNC must be a power of 2 within 8 .. 128 bytes"
+        #endif
+
+        // maximal number of bytes written per tick
+        #ifndef DISPLAY_ASYNC_BURST
+            #define DISPLAY_ASYNC_BURST 8
+        #endif
+        #if (DISPLAY_ASYNC_BURST < 1) || (DISPLAY_ASYNC_BURST > 255)
+            #error "DISPLAY_ASYNC_BURST must be within 1 .. 255 bytes"
+        #endif
+    #endif // #ifdef DISPLAY_ASYNC
+
+    // ram usage of the optional parts
+    #ifdef DISPLAY_ASYNC
+        #define ROBOLIB_DISPLAY_RAM_ASYNC (3 + 2 * DISPLAY_ASYNC)
+    #else
+        #define ROBOLIB_DISPLAY_RAM_ASYNC 0
+    #endif
+    #ifdef DISPLAY_NO_RW
+        #define ROBOLIB_DISPLAY_RAM_NO_RW 7
+    #else
+        #define ROBOLIB_DISPLAY_RAM_NO_RW 0
+    #endif
+    #ifdef DISPLAY_PIN_E2
+        #define ROBOLIB_DISPLAY_RAM_E2    2
+    #else
+        #define ROBOLIB_DISPLAY_RAM_E2    0
+    #endif
+
+    // for automated systick implementation see end of this file
 
 
     // for automated initializing see end of this file
@@ -119,7 +256,8 @@
 #endif // #ifndef doxygen
 
 //! The number of bytes the display modul uses in order to work
-#define ROBOLIB_RAM_COUNT_DISPLAY 1
+#define ROBOLIB_RAM_COUNT_DISPLAY (1 + ROBOLIB_DISPLAY_RAM_ASYNC + \
+  ROBOLIB_DISPLAY_RAM_NO_RW + ROBOLIB_DISPLAY_RAM_E2)
 
 //**************************<Included files>***********************************
 #include <inttypes.h>
@@ -192,6 +330,12 @@ void display_home(void);
  * @brief Moves the cursor to a given positon on the display.
  *
  * This function sets the cursor to the given position (x,y).
+ * The address of each row depends on DISPLAY_WIDTH and DISPLAY_HEIGHT.
+ * Positions outside of the display are ignored.
+ *
+ * On displays with two controllers (DISPLAY_PIN_E2) the rows 0..1 belong
+ * to the first and the rows 2..3 to the second controller. The following
+ * characters are printed by the controller of the selected row.
  *
  * If the display is not responding in a resonable amount of time
  * it will be disabled.
@@ -202,14 +346,12 @@ void display_home(void);
  * This function must be handled with care when called from within an interrupt.
  *
  * @param x
- * Sets the column of the cursor (0..15). \n
- * 0  is the most left  character.        \n
- * 15 is the most right character.
+ * Sets the column of the cursor (0..DISPLAY_WIDTH-1). \n
+ * 0  is the most left  character.
  *
  * @param y
- * Sets the row of the cursor (0..3)      \n
- * 0 is the upper most line.              \n
- * 3 is the lowest line.
+ * Sets the row of the cursor (0..DISPLAY_HEIGHT-1). \n
+ * 0 is the upper most line.
  *
  * @sa display_print(), display_clear(), display_home(), display_cursor()
  *
@@ -281,6 +423,40 @@ void display_cursor(uint8_t mode);
  */
 void display_setchar(uint8_t adr, uint8_t *data);
 
+/**
+ * @brief Waits until all queued data is written to the display.
+ *
+ * If DISPLAY_ASYNC is defined, all display functions only queue their
+ * data and return immediately. The systick writes up to
+ * DISPLAY_ASYNC_BURST bytes per tick to the display. This function waits
+ * until the queue is empty. If interrupts are disabled, the queue is
+ * written directly to the display.
+ *
+ * Without DISPLAY_ASYNC this function returns immediately.
+ *
+ * This function can be called from within an interrupt.
+ *
+ * @sa display_count_get()
+ */
+void display_wait(void);
+
+/**
+ * @brief Returns the number of queued bytes.
+ *
+ * If the queue is full (DISPLAY_ASYNC bytes), the display functions wait
+ * until the systick has written the next byte.
+ *
+ * Without DISPLAY_ASYNC this function returns always 0.
+ *
+ * This function can be called from within an interrupt.
+ *
+ * @return
+ * Number of queued bytes. [0..DISPLAY_ASYNC]
+ *
+ * @sa display_wait()
+ */
+uint8_t display_count_get(void);
+
 /**
  * @brief Enables the display modul.
  *
@@ -383,6 +559,32 @@ uint8_t display_is_enabled(void);
 #endif
 
 
+/**
+ * @brief Internal function.
+ *
+ * Do not call this function at all.
+ */
+void robolib_display_tick(void);
+
+// automated systick implementation
+#if !defined(__DOXYGEN__) && defined(DISPLAY_ASYNC)
+    // number of this hook (see robolib_tick_print())
+    #define ROBOLIB_TICK_HOOK_DISPLAY 3
+
+    __inline__ void robolib_display_tick_inline(void) {
+        #ifdef ROBOLIB_TICK_FUNCTION
+            ROBOLIB_TICK_FUNCTION();
+        #endif
+
+        robolib_display_tick();
+        robolib_tick_hook_done(ROBOLIB_TICK_HOOK_DISPLAY);
+    }
+
+    #undef ROBOLIB_TICK_FUNCTION
+    #define ROBOLIB_TICK_FUNCTION() robolib_display_tick_inline()
+#endif
+
+
 /**
  * @brief Internal function.
  *
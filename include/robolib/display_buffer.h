@@ -2,13 +2,19 @@
 * robolib/display_buffer.h                                                    *
 * ========================                                                    *
 *                                                                             *
-* Version: 1.0.0                                                              *
-* Date   : 27.09.15                                                           *
+* Version: 1.2.0                                                              *
+* Date   : 19.10.26                                                           *
 * Author : Peter Weissig                                                      *
 *                                                                             *
 * Changelog:                                                                  *
 *   27.09.15(V1.0.0)                                                          *
 *     - first release                                                         *
+*   19.10.26(V1.1.0)                                                          *
+*     - only changed rows are compared (dirty bits)                           *
+*     - added display_buffer_update_part()                                    *
+*   19.10.26(V1.2.0)                                                          *
+*     - up to 40x4 characters (see DISPLAY_WIDTH and DISPLAY_HEIGHT)          *
+*     - width defaults to the display (DISPLAY_WIDTH)                         *
 *                                                                             *
 * For help or bug report please visit:                                        *
 *   https://github.com/RoboAG/avr_robolib                                     *
@@ -20,12 +26,20 @@
 
 //**************************<Macros>*******************************************
 #ifndef __DOXYGEN__
+    // size of the display is needed for the defaults
+    #include <robolib/display.h>
+
+    // two rows (or less) as before
     #ifndef DISPLAY_BUFFER_HEIGHT
-        #define DISPLAY_BUFFER_HEIGHT 2
+        #if DISPLAY_HEIGHT < 2
+            #define DISPLAY_BUFFER_HEIGHT DISPLAY_HEIGHT
+        #else
+            #define DISPLAY_BUFFER_HEIGHT 2
+        #endif
     #endif // ifndef DISPLAY_BUFFER_HEIGHT
 
     #ifndef DISPLAY_BUFFER_WIDTH
-        #define DISPLAY_BUFFER_WIDTH 16
+        #define DISPLAY_BUFFER_WIDTH DISPLAY_WIDTH
     #endif // ifndef DISPLAY_BUFFER_WIDTH
 
     // warnings and errors
@@ -33,25 +47,29 @@
         #error "DISPLAY_BUFFER_HEIGHT must be between 1 and 4"
     #endif // #if (DISPLAY_BUFFER_HEIGHT < 1) || (4 < DISPLAY_BUFFER_HEIGHT)
 
-    #if (DISPLAY_BUFFER_WIDTH < 1) || (16 < DISPLAY_BUFFER_WIDTH)
-        #error "DISPLAY_BUFFER_WIDTH must be between 1 and 16"
-    #endif // #if (DISPLAY_BUFFER_WIDTH < 1) || (16 < DISPLAY_BUFFER_WIDTH)
+    // at most 160 characters - positions fit into 8 bits (0xFF is invalid)
+    #if (DISPLAY_BUFFER_WIDTH < 1) || (40 < DISPLAY_BUFFER_WIDTH)
+        #error "DISPLAY_BUFFER_WIDTH must be between 1 and 40"
+    #endif // #if (DISPLAY_BUFFER_WIDTH < 1) || (40 < DISPLAY_BUFFER_WIDTH)
+
+    #if (DISPLAY_BUFFER_HEIGHT > DISPLAY_HEIGHT) || \
+      (DISPLAY_BUFFER_WIDTH > DISPLAY_WIDTH)
+        #error "display buffer must not be larger than the display"
+    #endif
 
 
     // for automated initializing see end of this file
 
 #endif // #ifndef doxygen
 
-//! The number of bytes the display modul uses in order to work
-#define ROBOLIB_RAM_COUNT_DISPLAY \
-  2 * DISPLAY_BUFFER_WIDTH * DISPLAY_BUFFER_HEIGHT + 1
+//! The number of bytes the display buffer modul uses in order to work
+#define ROBOLIB_RAM_COUNT_DISPLAY_BUFFER \
+  (2 * DISPLAY_BUFFER_WIDTH * DISPLAY_BUFFER_HEIGHT + 3)
 
 //**************************<Included files>***********************************
 #include <inttypes.h>
 #include <avr/interrupt.h>
 
-#include <robolib/display.h>
-
 //**************************<Types>********************************************
 
 //**************************<Functions>****************************************
@@ -90,7 +108,7 @@ void display_buffer_clear(void);
  * This function can be called from within an interrupt.
  *
  * @param x
- * Sets the column of the cursor (0..15). \n
+ * Sets the column of the cursor (0..39). \n
  * 0  is the most left  character.        \n
  * The maximum is defined bei DISPLAY_BUFFER_WIDTH
  *
@@ -108,7 +126,10 @@ void display_buffer_gotoxy(uint8_t x,uint8_t y);
  * @brief Updates the real display with the data from the virtual display.
  *
  * This functions synchonized the display with the virtual display.
- * But only changed characters are printed.
+ * But only changed characters are printed. Rows, which were not written
+ * by display_buffer_print() since the last update, are skipped.
+ * The cursor of the display is only moved, if something was printed or
+ * display_buffer_gotoxy() was called.
  *
  * If the display is not responding in a resonable amount of time
  * it will be disabled.
@@ -118,10 +139,36 @@ void display_buffer_gotoxy(uint8_t x,uint8_t y);
  *
  * This function must be handled with care when called from within an interrupt.
  *
- * @sa display_buffer_print(), display_buffer_updateall()
+ * @sa display_buffer_print(), display_buffer_update_part(),
+ *     display_buffer_updateall()
  */
 void display_buffer_update(void);
 
+/**
+ * @brief Updates a limited number of characters of the real display.
+ *
+ * This function works like display_buffer_update(), but prints at most
+ * count changed characters. The next call continues at the same position.
+ * This limits the time spent within each call (e.g. for each run of
+ * the main loop).
+ *
+ * If the display is not responding in a resonable amount of time
+ * it will be disabled.
+ *
+ * This function must be handled with care when called from within an interrupt.
+ *
+ * @param count
+ * Maximum number of characters to be printed. [0..255]
+ *
+ * @return
+ * Boolean value. \n
+ * False (== 0x00) means there are still changed characters left. \n
+ * True  (!= 0x00) means the display is up to date.               \n
+ *
+ * @sa display_buffer_update()
+ */
+uint8_t display_buffer_update_part(uint8_t count);
+
 /**
  * @brief Updates the real display with the whole virtual display.
  *
@@ -150,6 +197,7 @@ void display_buffer_updateall(void);
  * display:
  *   x         : 5
  *   y         : 0
+ *   dirty     : 0b10000010
  *   buffer[0] : "Display :-)     "
  *   buffer[1] : "####            "
  *   current[0]: "Display :-D     "
@@ -2,13 +2,25 @@
 * robolib/tick.h                                                              *
 * ==============                                                              *
 *                                                                             *
-* Version: 1.0.1                                                              *
-* Date   : 20.03.18                                                           *
+* Version: 1.5.0                                                              *
+* Date   : 19.10.26                                                           *
 * Author : Peter Weissig                                                      *
 *                                                                             *
 * Changelog:                                                                  *
 *   27.09.15(V1.0.0)                                                          *
 *     - first release                                                         *
+*   19.10.26(V1.1.0)                                                          *
+*     - systick selectable between all timers (TICK_SYSTICK)                  *
+*     - asynchronous timer with watch crystal (TICK_ASYNC_CLOCK)              *
+*   19.10.26(V1.2.0)                                                          *
+*     - added tick_idle()                                                     *
+*     - optional load meter (TICK_LOAD)                                       *
+*   19.10.26(V1.3.0)                                                          *
+*     - optional measuring of interrupt latency (TICK_LATENCY)                *
+*   19.10.26(V1.4.0)                                                          *
+*     - ticks are no longer lost if the hooks take too long (overruns)        *
+*   19.10.26(V1.5.0)                                                          *
+*     - added tick_sleep() and tick_sleep_until()                             *
 *                                                                             *
 * For help or bug report please visit:                                        *
 *   https://github.com/RoboAG/avr_robolib                                     *
@@ -20,7 +32,8 @@
 
 //**************************<Macros>*******************************************
 //! The number of bytes the tick modul uses in order to work
-#define ROBOLIB_RAM_COUNT_TICK 0
+#define ROBOLIB_RAM_COUNT_TICK \
+  (11 + ROBOLIB_RAM_COUNT_TICK_LOAD + ROBOLIB_RAM_COUNT_TICK_LATENCY)
 
 #ifndef __DOXYGEN__
 
@@ -30,6 +43,60 @@
     #endif // #ifndef F_CPU
 
 
+    // names of the timers (used for selecting the systick)
+    #define TIMER0 0
+    #define TIMER1 1
+    #define TIMER2 2
+    #define TIMER3 3
+    #define TIMER4 4
+    #define TIMER5 5
+
+    // timer used for the systick (older ini-files use other names)
+    #ifndef TICK_SYSTICK
+        #if   defined(TIMER_SYSTICK)
+            #define TICK_SYSTICK TIMER_SYSTICK
+        #elif defined(TICK_TIMER)
+            #define TICK_SYSTICK TICK_TIMER
+        #else
+            #define TICK_SYSTICK TIMER0
+        #endif
+    #endif // #ifndef TICK_SYSTICK
+
+    // size of the window of the load meter (in seconds)
+    #ifdef TICK_LOAD
+        #ifndef TICK_LOAD_WINDOW
+            #define TICK_LOAD_WINDOW 8
+        #endif
+        #if (TICK_LOAD_WINDOW < 1) || (TICK_LOAD_WINDOW > 60)
+            #error "TICK_LOAD_WINDOW must be within 1 .. 60 seconds"
+        #endif
+        #define ROBOLIB_RAM_COUNT_TICK_LOAD (22 + TICK_LOAD_WINDOW)
+    #else
+        #define ROBOLIB_RAM_COUNT_TICK_LOAD 0
+    #endif // #ifdef TICK_LOAD
+
+    // measuring of interrupt latency and sections with disabled interrupts
+    #ifdef TICK_LATENCY
+        #define ROBOLIB_RAM_COUNT_TICK_LATENCY 45
+        #define ROBOLIB_TICK_CLI_BEGIN(mSREG) robolib_tick_cli_begin(mSREG)
+        #define ROBOLIB_TICK_CLI_END(mSREG)   \
+          robolib_tick_cli_end(mSREG,                                  \
+          ROBOLIB_TICK_CLI_NAME(__INCLUDE_LEVEL__), __LINE__)
+        // one filename per source file (within the flash) - included
+        // files (e.g. adc_atmega2561.c) get their own filename
+        #define ROBOLIB_TICK_CLI_FILE()       \
+          static const char ROBOLIB_TICK_CLI_NAME(__INCLUDE_LEVEL__)[] \
+          PROGMEM = __FILE__;
+        #define ROBOLIB_TICK_CLI_NAME(level)  ROBOLIB_TICK_CLI_NAME_(level)
+        #define ROBOLIB_TICK_CLI_NAME_(level) robolib_tick_cli_filename_##level
+    #else
+        #define ROBOLIB_RAM_COUNT_TICK_LATENCY 0
+        #define ROBOLIB_TICK_CLI_BEGIN(mSREG)
+        #define ROBOLIB_TICK_CLI_END(mSREG)
+        #define ROBOLIB_TICK_CLI_FILE()
+    #endif // #ifdef TICK_LATENCY
+
+
     // for automated initializing see end of this file
 
 #endif // #ifndef doxygen
@@ -37,8 +104,18 @@
 //**************************<Included files>***********************************
 #include <inttypes.h>
 #include <avr/interrupt.h>
+#include <avr/pgmspace.h>
 
 //**************************<Types>********************************************
+/// CPU load measured by the systick (see tick_load_get())
+struct tick_load {
+    uint8_t  last;      ///< load of the last second in percent [0..100]
+    uint8_t  min;       ///< minimal load within the window in percent
+    uint8_t  avg;       ///< average load within the window in percent
+    uint8_t  max;       ///< maximal load within the window in percent
+    uint16_t hooks_avg; ///< average time per tick within hooks in us (last second)
+    uint16_t hooks_max; ///< maximal time of one tick within hooks in us
+};
 
 //**************************<Functions>****************************************
 
@@ -62,10 +139,59 @@
  * @param mseconds
  * Time-period in milliseconds.
  *
- * @sa delay_ms()
+ * @sa delay_ms(), tick_sleep()
  */
 void tick_delay(uint16_t mseconds);
 
+/**
+ * @brief Sleeps for at least mseconds milliseconds.
+ *
+ * In contrast to tick_delay() this function never returns early. The
+ * time-period is rounded up to the next tick and the current tick, which
+ * is already partly elapsed, is not counted.
+ * E.g. A value of 283 waits for 290-300 milliseconds.
+ *
+ * While waiting, the cpu is sent to the idle sleep mode (see tick_idle()).
+ * All interrupts are handled as usual and the waiting time is counted as
+ * idle time by the load meter.
+ *
+ * This function should not be called from within an interrupt.
+ * It will enable the global interrupt flag. Within critical sections
+ * the busy delays (e.g. delay_ms()) must be used instead.
+ *
+ * @param mseconds
+ * Time-period in milliseconds.
+ *
+ * @sa tick_sleep_until(), tick_delay()
+ */
+void tick_sleep(uint16_t mseconds);
+
+/**
+ * @brief Sleeps until the given systick value is reached.
+ *
+ * This function sends the cpu to the idle sleep mode until tick_get()
+ * reaches the given time (see tick_idle()). It returns immediately, if the
+ * time has already passed. The time must not be more than 32767 ticks
+ * (about 5 minutes) ahead. E.g. for a periodic main loop:
+ * @code
+ * uint16_t time = tick_get();
+ * while (1) {
+ *     time+= 5; // every 50 milliseconds
+ *     tick_sleep_until(time);
+ *     ...
+ * }
+ * @endcode
+ *
+ * This function should not be called from within an interrupt.
+ * It will enable the global interrupt flag.
+ *
+ * @param time
+ * Internal time. [0..65535]
+ *
+ * @sa tick_sleep(), tick_get()
+ */
+void tick_sleep_until(uint16_t time);
+
 /**
  * @brief Returns the current systick value.
  *
@@ -164,10 +290,118 @@ uint8_t tick_tohsec(uint16_t time);
 uint16_t tick_tomsec(uint16_t time);
 
 
+/**
+ * @brief Returns the number of overruns.
+ *
+ * The hooks of the systick (e.g. tick_userfunction()) are called with
+ * enabled interrupts, but masked systick interrupt. After each hook a
+ * compare match of the systick timer is counted. So if they take longer
+ * than one tick, the following ticks are still counted, but their hooks
+ * are skipped. A single hook longer than two ticks is only counted once.
+ * This function returns the number of skipped ticks since the last reset.
+ * The longest overrun and the responsible hook are printed by
+ * robolib_tick_print().
+ *
+ * This function can be called from within an interrupt.
+ *
+ * @return
+ * Number of skipped ticks. [0..65535]
+ *
+ * @sa tick_overrun_reset()
+ */
+uint16_t tick_overrun_get(void);
+
+/**
+ * @brief Resets the overrun counter.
+ *
+ * This function clears the number of overruns and the longest overrun.
+ *
+ * This function can be called from within an interrupt.
+ *
+ * @sa tick_overrun_get()
+ */
+void tick_overrun_reset(void);
+
+/**
+ * @brief Sleeps until the next interrupt occurs.
+ *
+ * This function sends the cpu to the idle sleep mode. It returns after the
+ * next interrupt (e.g. the systick) was handled.
+ * It is meant to be called from the main loop whenever there is nothing to do.
+ *
+ * If TICK_LOAD is defined, the time spent sleeping is counted as idle time
+ * for the load meter.
+ *
+ * This function should not be called from within an interrupt.
+ * It will enable the global interrupt flag.
+ *
+ * @sa tick_load_get()
+ */
+void tick_idle(void);
+
+/**
+ * @brief Returns the cpu load.
+ *
+ * This function copies the current results of the load meter.
+ * Once per second the systick calculates the load of the last second by
+ * subtracting the idle time (see tick_idle()) from the elapsed time.
+ * Minimum, average and maximum are taken from the last TICK_LOAD_WINDOW
+ * seconds (default is 8). Additionally the time spent within the tick
+ * hooks (e.g. tick_userfunction()) is measured.
+ *
+ * The load meter is only available if TICK_LOAD is defined.
+ *
+ * This function can be called from within an interrupt.
+ *
+ * @param load
+ * Pointer to the structure which will be filled.
+ *
+ * @sa tick_idle(), tick_load_reset()
+ */
+void tick_load_get(struct tick_load* load);
+
+/**
+ * @brief Resets the load meter.
+ *
+ * This function clears the window of the load meter and the maximal time
+ * spent within the tick hooks.
+ *
+ * The load meter is only available if TICK_LOAD is defined.
+ *
+ * This function can be called from within an interrupt.
+ *
+ * @sa tick_load_get()
+ */
+void tick_load_reset(void);
+
+/**
+ * @brief Resets the latency measurement.
+ *
+ * This function clears the histogram of the interrupt latency of the systick
+ * and the longest section with disabled interrupts.
+ * The results are printed by robolib_tick_print().
+ *
+ * The latency of the systick is the time between the compare match of the
+ * timer and the begin of the interrupt routine. It is measured with the
+ * resolution of the timer (e.g. TIMER1 with a prescaler of 8 gives
+ * 0.5 us at 16 MHz). The sections with disabled interrupts are measured
+ * within the critical sections of the library (uart, adc and display).
+ *
+ * The measurement is only available if TICK_LATENCY is defined.
+ *
+ * This function can be called from within an interrupt.
+ *
+ * @sa robolib_tick_print()
+ */
+void tick_latency_reset(void);
+
+
 /**
  * @brief Systick function.
  *
  * If the systick is used, this function will be called every 10ms.
+ * It is called with enabled interrupts and must return within one tick.
+ * Otherwise the following calls are skipped (see tick_overrun_get()).
  *
  * @note This function must be implemented by the user.
  */
@@ -183,7 +417,16 @@ void tick_userfunction(void);
  * @code
  * tick:
  *   tic         : 23085
+ *   overruns    :     0
+ *   load        :  23 %
+ *   load[min]   :  12 %
+ *    ...
+ *   latency[max]:    48 us
+ *   latency<=   0 us:  6528
+ *   latency<=  12 us:   103
  *    ...
+ *   cli[max]    :    36 us
+ *   cli[pos]    : uart0/uart0.c:166
  * @endcode
  *
  * This function passes the resulting string byte by byte to the
@@ -236,6 +479,27 @@ void tick_userfunction(void);
 #endif
 
 
+/**
+ * @brief Internal function.
+ *
+ * Do not call this function at all.
+ */
+void robolib_tick_cli_begin(uint8_t mSREG);
+
+/**
+ * @brief Internal function.
+ *
+ * Do not call this function at all.
+ */
+void robolib_tick_cli_end(uint8_t mSREG, const char* file, uint16_t line);
+
+/**
+ * @brief Internal function.
+ *
+ * Do not call this function at all.
+ */
+void robolib_tick_hook_done(uint8_t hook);
+
 /**
  * @brief Internal function.
  *
@@ -243,6 +507,21 @@ void tick_userfunction(void);
  */
 void robolib_tick_init(void);
 
+/**
+ * @brief Internal function.
+ *
+ * Returns a free running counter of timer steps (e.g. for short waits of
+ * other modules). Differences of two values are valid up to 65535 steps.
+ */
+uint16_t robolib_tick_steps_get(void);
+
+/**
+ * @brief Internal function.
+ *
+ * Converts microseconds into timer steps (rounded up).
+ */
+uint16_t robolib_tick_us_to_steps(uint16_t useconds);
+
 // automated initializing
 #ifndef __DOXYGEN__
     __inline__ void robolib_tick_init_inline(void) {
@@ -43,6 +43,12 @@ sudo apt-get install -y doxygen
 sudo apt-get install -y exuberant-ctags
 
 
+#***************************[simulator]***************************************
+# 2026 10 19
+
+sudo apt-get install -y simavr
+
+
 #***************************[additionals]*************************************
 # 2018 01 18
 
@@ -0,0 +1,78 @@
+#!/bin/bash
+
+#***************************[paths]*******************************************
+# 2026 10 19
+
+PATH_ROBOLIB="$(cd "$(dirname "${BASH_SOURCE[0]}")/.." && pwd)/"
+PATH_EXAMPLE="${PATH_ROBOLIB}src/examples/delay/"
+PATH_TEST="${PATH_ROBOLIB}tmp/test/delay/"
+
+# tables of all simulations (to be tracked over time)
+FILE_RESULTS="${PATH_EXAMPLE}results.txt"
+
+# tested frequencies and maximal runtime of each simulation (in seconds)
+FREQUENCIES="16000000 20000000"
+TIMEOUT=120
+
+
+#***************************[build and simulate]******************************
+# 2026 10 19
+
+failed=0
+echo "# delay test $(date +%Y-%m-%d) (make test_delay)" > "${FILE_RESULTS}"
+for mcu in $(cat "${PATH_EXAMPLE}mcu.txt"); do
+    for f_cpu in $FREQUENCIES; do
+        dir="${PATH_TEST}${mcu}_${f_cpu}/"
+        echo ""
+        echo "### delay test for ${mcu} with ${f_cpu} Hz ###"
+
+        # copy the example and set the frequency
+        rm -rf "${dir}"
+        mkdir -p "${dir}"
+        cp "${PATH_EXAMPLE}delay.c" "${dir}"
+        sed "s/^#define F_CPU .*/#define F_CPU ${f_cpu}/" \
+          "${PATH_EXAMPLE}delay.ini" > "${dir}delay.ini"
+
+        make -C "${dir}" -f "${PATH_ROBOLIB}make/Makefile" MCU="${mcu}" \
+          > "${dir}make.log" 2>&1
+        if [ $? -ne 0 ] || [ ! -f "${dir}out.hex" ]; then
+            echo "build failed (see ${dir}make.log)"
+            echo "" >> "${FILE_RESULTS}"
+            echo "## ${mcu} ${f_cpu}: build failed" >> "${FILE_RESULTS}"
+            failed=$((failed + 1))
+            continue
+        fi
+
+        # simulate until the first table is complete
+        # (uart output without colors and carriage returns)
+        timeout ${TIMEOUT} simavr -m "${mcu}" -f "${f_cpu}" \
+          "${dir}out.hex" 2>&1 | \
+          sed -u -e 's/\x1b\[[0-9;]*m//g' -e 's/\r//g' | \
+          sed -u '/failed: /q' > "${dir}simavr.log"
+        cat "${dir}simavr.log"
+        echo "" >> "${FILE_RESULTS}"
+        echo "## ${mcu}" >> "${FILE_RESULTS}"
+        cat "${dir}simavr.log" >> "${FILE_RESULTS}"
+
+        if ! grep -q "failed: " "${dir}simavr.log"; then
+            echo "simulation incomplete (see ${dir}simavr.log)"
+            echo "simulation incomplete" >> "${FILE_RESULTS}"
+            failed=$((failed + 1))
+        elif grep -q " FAIL$" "${dir}simavr.log"; then
+            failed=$((failed + 1))
+        fi
+    done
+done
+
+
+#***************************[done]********************************************
+# 2026 10 19
+
+echo ""
+echo "tables written to ${FILE_RESULTS}"
+if [ ${failed} -ne 0 ]; then
+    echo "${failed} delay test(s) failed :-("
+    exit 1
+else
+    echo "all delay tests passed :-)"
+fi
@@ -38,7 +38,7 @@ int main (void) {
 
     // calculate number of next channel
     nr++;
-    if (nr > 7) { nr = 0;}
+    if (nr >= ADC_CHANNELS) { nr = 0;}
 
     // wait for 0.25 seconds
     delay_ms(250);
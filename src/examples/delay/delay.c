@@ -0,0 +1,214 @@
+/******************************************************************************
+* examples/delay.c                                                            *
+* ================                                                            *
+*                                                                             *
+* Version: 1.0.0                                                              *
+* Date   : 19.10.26                                                           *
+* Author : Peter Weissig                                                      *
+*                                                                             *
+* For help or bug report please visit:                                        *
+*   https://github.com/RoboAG/avr_robolib                                     *
+******************************************************************************/
+
+// include from gcc
+#include <inttypes.h>
+#include <avr/io.h>
+
+// include all necessary headers from robolib
+#include "delay.h"
+
+// allowed error in 0.1%
+#define TOLERANCE 20
+// additionally allowed cpu cycles for calling delay_us() and delay_ms()
+// (loading the argument, call, return and first check of the argument)
+#define TOLERANCE_CALL 16
+
+// measures the cpu cycles of a statement with TIMER1 (no prescaler)
+#define MEASURE(statement) \
+  TCNT1 = 0; TCCR1B = _BV(CS10); statement; TCCR1B = 0x00
+
+// kind of tested delay
+#define DELAY_US     0
+#define DELAY_MS     1
+#define LOOPDELAY    2
+#define DELAY_CYCLES 3
+
+// arguments to be tested (all delays are shorter than 65536 cycles)
+const uint8_t  kinds[] = {
+  DELAY_US, DELAY_US, DELAY_US, DELAY_US, DELAY_US, DELAY_US,
+  DELAY_MS, DELAY_MS, DELAY_MS,
+  LOOPDELAY, LOOPDELAY, LOOPDELAY, LOOPDELAY,
+  DELAY_CYCLES, DELAY_CYCLES, DELAY_CYCLES, DELAY_CYCLES};
+const uint16_t args[]  = {
+  1, 2, 5, 10, 20, 40,
+  1, 2, 3,
+  1, 10, 100, 255,
+  1, 10, 100, 1000};
+
+// same call as loopdelay() but without the loop (overhead of the call)
+void __attribute__((noinline)) loopdelay_call(uint8_t count) {
+  __asm__ volatile ("" : : "r" (count));
+}
+
+// runs one delay and returns the number of cpu cycles
+uint16_t measure(uint8_t kind, uint16_t arg) {
+  uint8_t mSREG = SREG;
+  cli();
+
+  TCCR1A = 0x00;
+  TCCR1B = 0x00;
+
+  switch (kind) {
+    case DELAY_US : MEASURE(delay_us(arg)); break;
+    case DELAY_MS : MEASURE(delay_ms(arg)); break;
+    case LOOPDELAY: MEASURE(loopdelay((uint8_t) arg)); break;
+    default       :
+      // delay_cycles needs compile time constants
+      switch (arg) {
+        case    1: MEASURE(delay_cycles(   1)); break;
+        case   10: MEASURE(delay_cycles(  10)); break;
+        case  100: MEASURE(delay_cycles( 100)); break;
+        default  : MEASURE(delay_cycles(1000)); break;
+      }
+  }
+  uint16_t result = TCNT1;
+
+  // overhead of starting and stopping the timer
+  // (and of calling loopdelay, which is not part of its 3 cycles per loop)
+  TCNT1 = 0;
+  if (kind == LOOPDELAY) {
+    MEASURE(loopdelay_call((uint8_t) arg));
+  } else {
+    MEASURE();
+  }
+  result-= TCNT1;
+
+  SREG = mSREG;
+  return result;
+}
+
+// returns the expected number of cpu cycles
+uint32_t expected(uint8_t kind, uint16_t arg) {
+  switch (kind) {
+    case DELAY_US : return (F_CPU / 100000) * arg;
+    case DELAY_MS : return (F_CPU /   1000) * arg;
+    case LOOPDELAY: return (uint32_t) arg * 3 - 1;
+    default       : return arg;
+  }
+}
+
+int main (void) {
+  // initialize robolib
+  robolib_init();
+
+  // wait for the start of a terminal
+  delay_ms(100);
+
+  // endless loop
+  while (1) {
+    uint8_t failed = 0;
+    uint8_t i;
+
+    string_from_const(uart0_send, "delay test (F_CPU = ");
+    string_from_macro(uart0_send, F_CPU);
+    string_from_const(uart0_send, ")\r\n");
+    string_from_const(uart0_send,
+      "kind  arg expected measured error[0.1%] result\r\n");
+
+    for (i = 0; i < sizeof(args) / sizeof(args[0]); i++) {
+      // wait until the uart is idle - no interrupts while measuring
+      while (uart0_txcount_get()) {}
+      delay_ms(2);
+
+      uint16_t measured = measure(kinds[i], args[i]);
+      uint32_t should   = expected(kinds[i], args[i]);
+
+      int32_t error = ((int32_t) measured - (int32_t) should) * 1000 /
+        (int32_t) should;
+      if (error >  9999) { error =  9999;}
+      if (error < -9999) { error = -9999;}
+
+      // the call overhead is fixed and not part of the relative error
+      uint32_t allowed = should * TOLERANCE / 1000;
+      if ((kinds[i] == DELAY_US) || (kinds[i] == DELAY_MS)) {
+        allowed+= TOLERANCE_CALL;
+      }
+
+      switch (kinds[i]) {
+        case DELAY_US : string_from_const(uart0_send, "us  "); break;
+        case DELAY_MS : string_from_const(uart0_send, "ms  "); break;
+        case LOOPDELAY: string_from_const(uart0_send, "loop"); break;
+        default       : string_from_const(uart0_send, "cyc "); break;
+      }
+      string_from_uint (uart0_send, args[i], 5);
+      string_from_const(uart0_send, " ");
+      string_from_uint (uart0_send, should, 8);
+      string_from_const(uart0_send, " ");
+      string_from_uint (uart0_send, measured, 8);
+      string_from_const(uart0_send, " ");
+      string_from_int  (uart0_send, error, 11);
+
+      if ((measured > should + allowed) || (measured + allowed < should)) {
+        string_from_const(uart0_send, " FAIL\r\n");
+        failed++;
+      } else {
+        string_from_const(uart0_send, " ok\r\n");
+      }
+    }
+
+    string_from_const(uart0_send, "failed: ");
+    string_from_uint (uart0_send, failed, 1);
+    string_from_const(uart0_send, "\r\n\r\n");
+
+    // wait for 5 seconds
+    delay_ms(5000);
+  }
+
+  return (0);
+}
+
+/******************************************************************************
+*                                                                             *
+* How to compile this example                                                 *
+* ===========================                                                 *
+*                                                                             *
+* required files                                                              *
+*   + delay.c               (source code, this file)                          *
+*   + delay.ini             (headerfile as '.ini')                            *
+*   + Makefile              (needed for compiling, linking and downloading)   *
+*                                                                             *
+* 1. adjust Makefile                              (only needed once)          *
+*   + set "MCU" to the controller type              (e.g. atmega64)           *
+*   + set "PATH_LIB" to the library                 (e.g. ~/avr/robolib)      *
+*                                                                             *
+* 2. compile library and create headerfile        (only needed once)          *
+*   + open a console                                (e.g. strg+alt+t)         *
+*   + change to the directory of the files          (e.g. cd ~/avr/test/)     *
+*   + run make with "ini" as parameter              (e.g. make ini)           *
+*     ==> check output for errors                                             *
+*                                                                             *
+* 3. compile main file and link everything        (needed for all changes)    *
+*   + open a console                                (e.g. strg+alt+t)         *
+*   + change to the directory of the files          (e.g. cd ~/avr/test/)     *
+*   + run make with "all" as parameter              (e.g. make all)           *
+*     ==> check output for errors                                             *
+*                                                                             *
+* How to run this example                                                     *
+* =======================                                                     *
+*                                                                             *
+* The measurement uses TIMER1 as cycle counter, so the results are the same   *
+* on the board and within a cycle accurate simulator. For other values of     *
+* F_CPU (e.g. 20MHz) change the ini-file and compile again.                   *
+*                                                                             *
+* 1. run within simavr                            (no hardware needed)        *
+*   + run simavr with mcu and frequency   (e.g. simavr -m atmega644p          *
+*                                                  -f 16000000 out.hex)       *
+*     ==> the table is printed to the console (uart0)                         *
+*   + or test all mcu with 16MHz and 20MHz          (e.g. make test_delay)    *
+*     ==> fails if any delay is out of tolerance                              *
+*     ==> all tables are written to results.txt (next to this file)           *
+*                                                                             *
+* 2. or download result to the board              (see other examples)        *
+*   + open a terminal with 57600 baud               (e.g. gtkterm)            *
+*                                                                             *
+******************************************************************************/
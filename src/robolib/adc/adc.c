@@ -10,21 +10,134 @@
 
 //**************************<File version>*************************************
 #define ROBOLIB_ADC_VERSION \
-  "robolib/adc/adc.c 23.09.2014 V1.0.0"
+  "robolib/adc/adc.c 19.10.2026 V1.8.0"
 
 //**************************<Included files>***********************************
 #include <robolib/adc.h>
 
 #include <robolib/string.h>
+#include <robolib/tick.h>
 
 #include <avr/io.h>
+#include <avr/sleep.h>
 
 //**************************<Variables>****************************************
-volatile uint16_t robolib_adc_values[8];
+volatile uint16_t robolib_adc_values[ADC_CHANNELS];
+
+// queue of requested channels (channel 0 .. ADC_CHANNELS - 1)
+volatile uint8_t  robolib_adc_current;
+volatile uint16_t robolib_adc_pending;
+volatile uint16_t robolib_adc_done;
+
+// single request of a special channel (e.g. differential input)
+volatile uint8_t  robolib_adc_single;
+volatile uint8_t  robolib_adc_single_done;
+volatile uint16_t robolib_adc_single_value;
+
+// conversions to be dropped while the reference settles
+volatile uint8_t  robolib_adc_settle;
+
+#ifdef ADC_TRIGGER
+    // channels converted continuously by the auto trigger
+    volatile uint16_t robolib_adc_trigger_mask;
+#endif
+
+#ifdef ADC_OVERSAMPLING
+    // additional bits per channel (4^n samples are summed up)
+    volatile uint8_t  robolib_adc_oversampling[ADC_CHANNELS];
+    volatile uint8_t  robolib_adc_oversampling_count[ADC_CHANNELS];
+    volatile uint16_t robolib_adc_oversampling_sum[ADC_CHANNELS];
+#endif
+
+#ifdef ADC_AVERAGE
+    // moving average over the last ADC_AVERAGE values per channel
+    volatile uint16_t robolib_adc_average_mask;
+    volatile uint8_t  robolib_adc_average_index[ADC_CHANNELS];
+    volatile uint16_t robolib_adc_average_sum[ADC_CHANNELS];
+    volatile uint16_t robolib_adc_average_buffer[ADC_CHANNELS][ADC_AVERAGE];
+#endif
+
+#ifdef ADC_FILTER
+    // state of the filter per channel
+    struct robolib_adc_filter {
+        uint8_t  config;       // type (bit 4-5) and shift - 1 (bit 0-2)
+        uint8_t  index;        // position within history
+        union {
+            uint32_t acc;      // iir: filtered value * 2^shift
+            uint16_t history[5];
+        } data;
+        uint16_t value;
+        uint16_t min;
+        uint16_t max;
+    };
+    volatile struct robolib_adc_filter robolib_adc_filters[ADC_CHANNELS];
+#endif
+
+// source file of sections with disabled interrupts (TICK_LATENCY)
+ROBOLIB_TICK_CLI_FILE()
 
 //**************************<Prototypes>***************************************
+void robolib_adc_next(void);
+#ifdef ADC_FILTER
+    void robolib_adc_filter_update(uint8_t nr, uint16_t value);
+    void robolib_adc_filter_restart(uint8_t nr);
+#endif
 
 //**************************<Renaming>*****************************************
+#ifndef __DOXYGEN__
+    #if   ADC_PRESCALER ==   2
+        #define ROBOLIB_ADC_ADPS 0b001
+    #elif ADC_PRESCALER ==   4
+        #define ROBOLIB_ADC_ADPS 0b010
+    #elif ADC_PRESCALER ==   8
+        #define ROBOLIB_ADC_ADPS 0b011
+    #elif ADC_PRESCALER ==  16
+        #define ROBOLIB_ADC_ADPS 0b100
+    #elif ADC_PRESCALER ==  32
+        #define ROBOLIB_ADC_ADPS 0b101
+    #elif ADC_PRESCALER ==  64
+        #define ROBOLIB_ADC_ADPS 0b110
+    #elif ADC_PRESCALER == 128
+        #define ROBOLIB_ADC_ADPS 0b111
+    #else
+        #error "ADC_PRESCALER must be 2, 4, 8, 16, 32, 64 or 128"
+    #endif
+
+    // auto trigger by timer0 compare match (A) or timer1 compare match B
+    #ifdef ADC_TRIGGER
+        #if defined(TICK_SYSTICK) && (TICK_SYSTICK == ADC_TRIGGER)
+            #error "ADC_TRIGGER uses the same timer as the systick"
+        #endif
+        #define ROBOLIB_ADC_ADATE _BV(ADATE)
+        #if ADC_TRIGGER == TIMER0
+            #define ROBOLIB_ADC_ADTS 0b011
+        #else
+            #define ROBOLIB_ADC_ADTS 0b101
+        #endif
+    #else
+        #define ROBOLIB_ADC_ADATE 0x00
+        #define ROBOLIB_ADC_ADTS  0b000
+    #endif
+
+    // the 8-bit mode reads ADCH only
+    #if defined(ADC_8BIT) || defined(ADC_LEFT_ADJUST)
+        #define ROBOLIB_ADC_ADLAR _BV(ADLAR)
+    #else
+        #define ROBOLIB_ADC_ADLAR 0x00
+    #endif
+
+    #ifdef ADC_AVERAGE
+        #if   ADC_AVERAGE == 2
+            #define ROBOLIB_ADC_AVERAGE_SHIFT 1
+        #elif ADC_AVERAGE == 4
+            #define ROBOLIB_ADC_AVERAGE_SHIFT 2
+        #elif ADC_AVERAGE == 8
+            #define ROBOLIB_ADC_AVERAGE_SHIFT 3
+        #else
+            #error "ADC_AVERAGE must be 2, 4 or 8"
+        #endif
+    #endif // #ifdef ADC_AVERAGE
+#endif // #ifndef __DOXYGEN__
 
 //**************************<Files>********************************************
 #if    defined (__AVR_ATmega2561__) // switch micro controller
@@ -33,44 +146,174 @@ volatile uint16_t robolib_adc_values[8];
 #elif  defined (__AVR_ATmega64__)   // switch micro controller
 #  include <adc/adc_atmega64.c>
 #  define MCU atmega64
+#elif  defined (__AVR_ATmega328P__) // switch micro controller
+#  include <adc/adc_atmega328p.c>
+#  define MCU atmega328p
+#elif  defined (__AVR_ATmega644P__) // switch micro controller
+#  include <adc/adc_atmega644p.c>
+#  define MCU atmega644p
 #else                               // switch micro controller
 #  error "device is not supported (yet)"
 #endif                              // switch micro controller
 
-//**************************[adc_get]****************************************** 17.09.2014
+//**************************[adc_get]****************************************** 19.10.2026
 uint16_t adc_get(uint8_t nr) {
-  uint16_t result;
 
-  if (robolib_adc_wait() == 0x00) {
-    // robolib_adc_wait aktiviert Interrupts
+  if (adc_request(nr) == 0x00) {
     return 0xFFFF;
   }
-  // robolib_adc_wait deaktiviert Interrupts
 
-  robolib_adc_savevalue();
-  robolib_adc_setchannel(nr);
+  // wait for the conversion (the adc interrupt needs enabled interrupts)
+  cli();
+  ROBOLIB_TICK_CLI_BEGIN(_BV(SREG_I));
+  while (adc_is_complete(nr) == 0x00) {
+    if (adc_is_enabled() == 0x00) {
+      ROBOLIB_TICK_CLI_END(_BV(SREG_I));
+      sei();
+      return 0xFFFF;
+    }
 
-  if (robolib_adc_wait() == 0x00) {
-    // robolib_adc_wait aktiviert Interrupts
-    return 0xFFFF;
+    ROBOLIB_TICK_CLI_END(_BV(SREG_I));
+    #ifdef ADC_SLEEP
+      set_sleep_mode(SLEEP_MODE_ADC);
+      sleep_enable();
+      sei();
+      sleep_cpu();
+      sleep_disable();
+    #else
+      sei();
+    #endif
+    cli();
+    ROBOLIB_TICK_CLI_BEGIN(_BV(SREG_I));
   }
-  // robolib_adc_wait deaktiviert Interrupts
-  if (robolib_adc_savevalue() == nr) {
-    result = ADC;
-  } else if (nr < 8) {
-    result = robolib_adc_values[nr];
+  ROBOLIB_TICK_CLI_END(_BV(SREG_I));
+  sei();
+
+  if (nr >= ADC_CHANNELS) {
+    return robolib_adc_single_value;
+  }
+  return adc_buffer_get(nr);
+}
+
+//**************************[adc_request]************************************** 19.10.2026
+uint8_t adc_request(uint8_t nr) {
+
+  uint8_t mSREG = SREG;
+  cli();
+  ROBOLIB_TICK_CLI_BEGIN(mSREG);
+
+  if (adc_is_enabled() == 0x00) {
+    ROBOLIB_TICK_CLI_END(mSREG);
+    SREG = mSREG;
+    return 0x00;
+  }
+
+  if (nr < ADC_CHANNELS) {
+    robolib_adc_pending|=   (uint16_t) 1 << nr;
+    robolib_adc_done   &= ~ ((uint16_t) 1 << nr);
   } else {
-    result = 0xFFFF;
+    // only one special channel at once
+    if ((robolib_adc_single != 0xFF) && (robolib_adc_single != nr)) {
+      ROBOLIB_TICK_CLI_END(mSREG);
+      SREG = mSREG;
+      return 0x00;
+    }
+    robolib_adc_single      = nr;
+    robolib_adc_single_done = 0x00;
   }
 
-  sei();
+  // start conversion if adc is idle
+  // (with auto trigger the adc interrupt selects the next channel)
+  #ifndef ADC_TRIGGER
+    if (robolib_adc_current == 0xFF) {
+      robolib_adc_next();
+    }
+  #endif
+
+  ROBOLIB_TICK_CLI_END(mSREG);
+  SREG = mSREG;
+  return 0xFF;
+}
+
+//**************************[adc_request_mask]********************************* 19.10.2026
+uint8_t adc_request_mask(uint16_t mask) {
+
+  uint8_t mSREG = SREG;
+  cli();
+  ROBOLIB_TICK_CLI_BEGIN(mSREG);
+
+  if (adc_is_enabled() == 0x00) {
+    ROBOLIB_TICK_CLI_END(mSREG);
+    SREG = mSREG;
+    return 0x00;
+  }
+
+  mask&= ((uint16_t) 0xFFFF) >> (16 - ADC_CHANNELS);
+  robolib_adc_pending|=   mask;
+  robolib_adc_done   &= ~ mask;
+
+  // start conversion if adc is idle
+  // (with auto trigger the adc interrupt selects the next channel)
+  #ifndef ADC_TRIGGER
+    if (robolib_adc_current == 0xFF) {
+      robolib_adc_next();
+    }
+  #endif
+
+  ROBOLIB_TICK_CLI_END(mSREG);
+  SREG = mSREG;
+  return 0xFF;
+}
+
+//**************************[adc_is_complete]********************************** 19.10.2026
+uint8_t adc_is_complete(uint8_t nr) {
+
+  if (nr >= ADC_CHANNELS) {
+    return robolib_adc_single_done;
+  }
+
+  if (robolib_adc_done & ((uint16_t) 1 << nr)) {
+    return 0xFF;
+  } else {
+    return 0x00;
+  }
+}
+
+//**************************[adc_trigger_mask_set]***************************** 19.10.2026
+#ifdef ADC_TRIGGER
+void adc_trigger_mask_set(uint16_t mask) {
+
+  uint8_t mSREG = SREG;
+  cli();
+  ROBOLIB_TICK_CLI_BEGIN(mSREG);
+  robolib_adc_trigger_mask = mask &
+    (((uint16_t) 0xFFFF) >> (16 - ADC_CHANNELS));
+  ROBOLIB_TICK_CLI_END(mSREG);
+  SREG = mSREG;
+}
+#endif
+
+//**************************[adc_trigger_mask_get]***************************** 19.10.2026
+#ifdef ADC_TRIGGER
+uint16_t adc_trigger_mask_get(void) {
+
+  uint16_t result;
+  uint8_t mSREG = SREG;
+
+  cli();
+  ROBOLIB_TICK_CLI_BEGIN(mSREG);
+  result = robolib_adc_trigger_mask;
+  ROBOLIB_TICK_CLI_END(mSREG);
+  SREG = mSREG;
+
   return result;
 }
+#endif
 
-//**************************[adc_buffer_get]*********************************** 17.09.2014
+//**************************[adc_buffer_get]*********************************** 19.10.2026
 uint16_t adc_buffer_get(uint8_t nr) {
 
-  if (nr > 7) {
+  if (nr >= ADC_CHANNELS) {
     return 0xFFFF;
   }
 
@@ -78,7 +321,9 @@ uint16_t adc_buffer_get(uint8_t nr) {
   uint8_t mSREG = SREG;
 
   cli();
+  ROBOLIB_TICK_CLI_BEGIN(mSREG);
   result = robolib_adc_values[nr];
+  ROBOLIB_TICK_CLI_END(mSREG);
   SREG = mSREG;
 
   return result;
@@ -88,23 +333,285 @@ uint16_t adc_buffer_get(uint8_t nr) {
 void adc_enable(void) {
   uint8_t mSREG = SREG;
   cli();
+  ROBOLIB_TICK_CLI_BEGIN(mSREG);
 
   if ((ADCSRA & _BV(ADEN)) == 0x00) {
     ADCSRA|= _BV(ADEN);
   }
 
+  ROBOLIB_TICK_CLI_END(mSREG);
   SREG = mSREG;
 }
 
-//**************************[adc_disable]************************************** 06.09.2014
+//**************************[adc_disable]************************************** 19.10.2026
 void adc_disable(void) {
   uint8_t mSREG = SREG;
   cli();
+  ROBOLIB_TICK_CLI_BEGIN(mSREG);
 
   ADCSRA&= ~_BV(ADEN);
 
+  // drop all requests
+  robolib_adc_current = 0xFF;
+  robolib_adc_pending = 0x00;
+  robolib_adc_single  = 0xFF;
+
+  #ifdef ADC_OVERSAMPLING
+    uint8_t nr;
+    for (nr = 0; nr < ADC_CHANNELS; nr++) {
+      robolib_adc_oversampling_count[nr] = 0;
+      robolib_adc_oversampling_sum[nr]   = 0;
+    }
+  #endif
+
+  ROBOLIB_TICK_CLI_END(mSREG);
+  SREG = mSREG;
+}
+
+//**************************[adc_filter_set]*********************************** 19.10.2026
+#ifdef ADC_FILTER
+void adc_filter_set(uint8_t nr, uint8_t filter) {
+
+  if (nr >= ADC_CHANNELS) {
+    return;
+  }
+
+  uint8_t mSREG = SREG;
+  cli();
+  ROBOLIB_TICK_CLI_BEGIN(mSREG);
+  robolib_adc_filters[nr].config = filter & 0x37;
+  robolib_adc_filter_restart(nr);
+  ROBOLIB_TICK_CLI_END(mSREG);
+  SREG = mSREG;
+}
+#endif
+
+//**************************[adc_filter_get]*********************************** 19.10.2026
+#ifdef ADC_FILTER
+uint8_t adc_filter_get(uint8_t nr) {
+
+  if (nr >= ADC_CHANNELS) {
+    return ADC_FILTER_NONE;
+  }
+
+  return robolib_adc_filters[nr].config;
+}
+#endif
+
+//**************************[adc_filtered_get]********************************* 19.10.2026
+#ifdef ADC_FILTER
+uint16_t adc_filtered_get(uint8_t nr, struct adc_filtered* result) {
+
+  if (nr >= ADC_CHANNELS) {
+    return 0xFFFF;
+  }
+
+  uint16_t value;
+  uint8_t mSREG = SREG;
+
+  cli();
+  ROBOLIB_TICK_CLI_BEGIN(mSREG);
+  value = robolib_adc_filters[nr].value;
+  if (result) {
+    result->raw   = robolib_adc_values[nr];
+    result->value = value;
+    result->min   = robolib_adc_filters[nr].min;
+    result->max   = robolib_adc_filters[nr].max;
+  }
+  ROBOLIB_TICK_CLI_END(mSREG);
   SREG = mSREG;
+
+  return value;
 }
+#endif
+
+//**************************[adc_filter_minmax_reset]************************** 19.10.2026
+#ifdef ADC_FILTER
+void adc_filter_minmax_reset(uint8_t nr) {
+
+  if (nr >= ADC_CHANNELS) {
+    return;
+  }
+
+  uint8_t mSREG = SREG;
+  cli();
+  ROBOLIB_TICK_CLI_BEGIN(mSREG);
+  robolib_adc_filters[nr].min = 0xFFFF;
+  robolib_adc_filters[nr].max = 0x0000;
+  ROBOLIB_TICK_CLI_END(mSREG);
+  SREG = mSREG;
+}
+#endif
+
+//**************************[adc_prescaler_set]******************************** 19.10.2026
+uint8_t adc_prescaler_set(uint8_t prescaler) {
+
+  uint8_t bits;
+  for (bits = 1; bits <= 7; bits++) {
+    if ((1 << bits) == prescaler) {
+      uint8_t mSREG = SREG;
+      cli();
+      ROBOLIB_TICK_CLI_BEGIN(mSREG);
+      // don't clear the interrupt flag by writing it back
+      ADCSRA = (ADCSRA & ~(_BV(ADIF) | 0x07)) | bits;
+      ROBOLIB_TICK_CLI_END(mSREG);
+      SREG = mSREG;
+      return 0xFF;
+    }
+  }
+
+  return 0x00;
+}
+
+//**************************[adc_prescaler_get]******************************** 19.10.2026
+uint8_t adc_prescaler_get(void) {
+
+  uint8_t bits = ADCSRA & 0x07;
+  if (bits == 0) {
+    bits = 1;
+  }
+
+  return 1 << bits;
+}
+
+//**************************[adc_reference_set]******************************** 19.10.2026
+void adc_reference_set(uint8_t reference) {
+
+  uint8_t mSREG = SREG;
+  cli();
+  ROBOLIB_TICK_CLI_BEGIN(mSREG);
+
+  if ((ADMUX & 0xC0) != (reference & 0xC0)) {
+    ADMUX = (ADMUX & 0x3F) | (reference & 0xC0);
+    robolib_adc_settle = ADC_REFERENCE_SETTLE;
+  }
+
+  ROBOLIB_TICK_CLI_END(mSREG);
+  SREG = mSREG;
+}
+
+//**************************[adc_reference_get]******************************** 19.10.2026
+uint8_t adc_reference_get(void) {
+
+  return ADMUX & 0xC0;
+}
+
+//**************************[adc_left_adjust_set]****************************** 19.10.2026
+void adc_left_adjust_set(uint8_t enable) {
+
+  // sums of oversampling and average are limited to 16 bits
+  #if defined(ADC_OVERSAMPLING) || defined(ADC_AVERAGE)
+    enable = 0x00;
+  #endif
+
+  #ifndef ADC_8BIT
+    uint8_t mSREG = SREG;
+    cli();
+    ROBOLIB_TICK_CLI_BEGIN(mSREG);
+    if (enable) {
+      ADMUX|=   _BV(ADLAR);
+    } else {
+      ADMUX&= ~ _BV(ADLAR);
+    }
+    ROBOLIB_TICK_CLI_END(mSREG);
+    SREG = mSREG;
+  #endif
+}
+
+//**************************[adc_left_adjust_get]****************************** 19.10.2026
+uint8_t adc_left_adjust_get(void) {
+
+  if (ADMUX & _BV(ADLAR)) {
+    return 0xFF;
+  } else {
+    return 0x00;
+  }
+}
+
+//**************************[adc_oversampling_set]***************************** 19.10.2026
+#ifdef ADC_OVERSAMPLING
+void adc_oversampling_set(uint8_t nr, uint8_t bits) {
+
+  if ((nr >= ADC_CHANNELS) || (bits > 3)) {
+    return;
+  }
+
+  uint8_t mSREG = SREG;
+  cli();
+  ROBOLIB_TICK_CLI_BEGIN(mSREG);
+  robolib_adc_oversampling[nr]       = bits;
+  robolib_adc_oversampling_count[nr] = 0;
+  robolib_adc_oversampling_sum[nr]   = 0;
+  ROBOLIB_TICK_CLI_END(mSREG);
+  SREG = mSREG;
+}
+#endif
+
+//**************************[adc_oversampling_get]***************************** 19.10.2026
+#ifdef ADC_OVERSAMPLING
+uint8_t adc_oversampling_get(uint8_t nr) {
+
+  if (nr >= ADC_CHANNELS) {
+    return 0;
+  }
+
+  return robolib_adc_oversampling[nr];
+}
+#endif
+
+//**************************[adc_average_set]********************************** 19.10.2026
+#ifdef ADC_AVERAGE
+void adc_average_set(uint8_t nr, uint8_t enable) {
+
+  if (nr >= ADC_CHANNELS) {
+    return;
+  }
+
+  uint8_t mSREG = SREG;
+  cli();
+  ROBOLIB_TICK_CLI_BEGIN(mSREG);
+  if (enable) {
+    // start with the current value
+    uint16_t value = robolib_adc_values[nr];
+    uint8_t i;
+    for (i = 0; i < ADC_AVERAGE; i++) {
+      robolib_adc_average_buffer[nr][i] = value;
+    }
+    robolib_adc_average_sum[nr]   = value << ROBOLIB_ADC_AVERAGE_SHIFT;
+    robolib_adc_average_index[nr] = 0;
+    robolib_adc_average_mask|=   (uint16_t) 1 << nr;
+  } else {
+    robolib_adc_average_mask&= ~ ((uint16_t) 1 << nr);
+  }
+  ROBOLIB_TICK_CLI_END(mSREG);
+  SREG = mSREG;
+}
+#endif
+
+//**************************[adc_average_get]********************************** 19.10.2026
+#ifdef ADC_AVERAGE
+uint16_t adc_average_get(uint8_t nr) {
+
+  if (nr >= ADC_CHANNELS) {
+    return 0xFFFF;
+  }
+
+  uint16_t result;
+  uint8_t mSREG = SREG;
+
+  cli();
+  ROBOLIB_TICK_CLI_BEGIN(mSREG);
+  if (robolib_adc_average_mask & ((uint16_t) 1 << nr)) {
+    result = robolib_adc_average_sum[nr] >> ROBOLIB_ADC_AVERAGE_SHIFT;
+  } else {
+    result = robolib_adc_values[nr];
+  }
+  ROBOLIB_TICK_CLI_END(mSREG);
+  SREG = mSREG;
+
+  return result;
+}
+#endif
 
 //**************************[adc_is_enabled]*********************************** 11.09.2014
 uint8_t adc_is_enabled(void) {
@@ -115,7 +622,7 @@ uint8_t adc_is_enabled(void) {
   }
 }
 
-//**************************[robolib_adc_print]********************************* 16.09.2014
+//**************************[robolib_adc_print]********************************* 19.10.2026
 void robolib_adc_print(void (*out)(uint8_t)) {
   string_from_const(out, "adc:"                                        "\r\n");
 
@@ -123,18 +630,28 @@ void robolib_adc_print(void (*out)(uint8_t)) {
   string_from_bool(out, adc_is_enabled());      string_from_const(out, "\r\n");
 
   uint8_t nr;
-  for (nr = 0; nr < 8; nr++) {
-    string_from_const(out, "  channel["); out(nr + 48);
-    string_from_const_length(out, "]", 15 - 11);
+  for (nr = 0; nr < ADC_CHANNELS; nr++) {
+    string_from_const(out, "  channel["); string_from_uint(out, nr, 1);
+    string_from_const_length(out, "]", nr < 10 ? 15 - 11 : 15 - 12);
     string_from_const(out, ": ");
     string_from_uint(out, robolib_adc_values[nr], 4);
     string_from_const(out, "\r\n");
   }
 
+  string_from_const_length(out, "  prescaler", 15); string_from_const(out, ": ");
+  string_from_uint(out, adc_prescaler_get(), 3); string_from_const(out, "\r\n");
+
+  string_from_const_length(out, "  reference", 15); string_from_const(out, ": ");
+  string_from_hex(out, adc_reference_get(), 2); string_from_const(out, "\r\n");
+
+  string_from_const_length(out, "  pending", 15); string_from_const(out, ": ");
+  string_from_bits(out, robolib_adc_pending, -ADC_CHANNELS);
+                                                string_from_const(out, "\r\n");
+
   string_from_const(out,                                               "\r\n");
 }
 
-//**************************[robolib_adc_print_compiled]************************ 16.09.2014
+//**************************[robolib_adc_print_compiled]************************ 19.10.2026
 void robolib_adc_print_compiled(void (*out)(uint8_t)) {
   string_from_const(out, ROBOLIB_ADC_VERSION                            "\r\n");
   string_from_const(out, ROBOLIB_ADC_SUB_VERSION                        "\r\n");
@@ -142,18 +659,74 @@ void robolib_adc_print_compiled(void (*out)(uint8_t)) {
   string_from_const_length(out, "  MCU"    , 15); string_from_const(out, ": ");
   string_from_macro(out, MCU);                  string_from_const(out, "\r\n");
 
+  string_from_const_length(out, "  PRESCALER", 15); string_from_const(out, ": ");
+  string_from_macro(out, ADC_PRESCALER);        string_from_const(out, "\r\n");
+
+  string_from_const_length(out, "  REFERENCE", 15); string_from_const(out, ": ");
+  string_from_macro(out, ADC_REFERENCE);        string_from_const(out, "\r\n");
+
+  string_from_const_length(out, "  8BIT"   , 15); string_from_const(out, ": ");
+  #ifdef ADC_8BIT
+  string_from_const(out, "[enabled]");          string_from_const(out, "\r\n");
+  #else
+  string_from_const(out, "[disabled]");         string_from_const(out, "\r\n");
+  #endif
+
+  string_from_const_length(out, "  TRIGGER", 15); string_from_const(out, ": ");
+  #ifdef ADC_TRIGGER
+  string_from_macro(out, ADC_TRIGGER);          string_from_const(out, " (");
+  string_from_macro(out, ADC_TRIGGER_RATE);     string_from_const(out, " Hz)\r\n");
+  #else
+  string_from_const(out, "[disabled]");         string_from_const(out, "\r\n");
+  #endif
+
+  string_from_const_length(out, "  FILTER" , 15); string_from_const(out, ": ");
+  #ifdef ADC_FILTER
+  string_from_const(out, "[enabled]");          string_from_const(out, "\r\n");
+  #else
+  string_from_const(out, "[disabled]");         string_from_const(out, "\r\n");
+  #endif
+
+  string_from_const_length(out, "  CHANNELS", 15); string_from_const(out, ": ");
+  string_from_macro(out, ADC_CHANNELS);         string_from_const(out, "\r\n");
+
+  string_from_const_length(out, "  OVERSAMPLING", 15);
+                                                  string_from_const(out, ": ");
+  #ifdef ADC_OVERSAMPLING
+  string_from_const(out, "[enabled]");          string_from_const(out, "\r\n");
+  #else
+  string_from_const(out, "[disabled]");         string_from_const(out, "\r\n");
+  #endif
+
+  string_from_const_length(out, "  AVERAGE", 15); string_from_const(out, ": ");
+  #ifdef ADC_AVERAGE
+  string_from_macro(out, ADC_AVERAGE);          string_from_const(out, "\r\n");
+  #else
+  string_from_const(out, "[disabled]");         string_from_const(out, "\r\n");
+  #endif
+
+  string_from_const_length(out, "  SLEEP"  , 15); string_from_const(out, ": ");
+  #ifdef ADC_SLEEP
+  string_from_const(out, "[enabled]");          string_from_const(out, "\r\n");
+  #else
+  string_from_const(out, "[disabled]");         string_from_const(out, "\r\n");
+  #endif
+
   string_from_const(out,                                               "\r\n");
 }
 
 //**************************[robolib_adc_init]**********************************
 // siehe controllerspezifische Datei
 
-//**************************[robolib_adc_adcok]********************************* 16.09.2014
+//**************************[robolib_adc_adcok]********************************* 19.10.2026
 uint8_t robolib_adc_adcok(void) {
   // adc disabled ?
   if (adc_is_enabled() == 0x00) { return 0x00;}
   // conversation in progress ?
-  if (ADCSRA & _BV(ADSC)) { return 0x00;}
+  // (with auto trigger the multiplexer is set for the next conversion)
+  #ifndef ADC_TRIGGER
+    if (ADCSRA & _BV(ADSC)) { return 0x00;}
+  #endif
 
   return 0xFF;
 }
@@ -164,40 +737,192 @@ uint8_t robolib_adc_adcok(void) {
 //**************************[robolib_adc_setchannel]****************************
 // siehe controllerspezifische Datei
 
-//**************************[robolib_adc_savevalue]***************************** 16.09.2014
-uint8_t robolib_adc_savevalue(void) {
-  uint8_t mSREG = SREG;
-  uint8_t temp;
-
-  cli();
-  if (robolib_adc_adcok() == 0x00) {
-    SREG = mSREG;
-    return 0xFF;
-  }
+//**************************[robolib_adc_filter_restart]*********************** 19.10.2026
+// Achtung: muss mit deaktivierten Interrupts aufgerufen werden!
+#ifdef ADC_FILTER
+void robolib_adc_filter_restart(uint8_t nr) {
 
-  temp = robolib_adc_getchannel();
+  volatile struct robolib_adc_filter* filter = &robolib_adc_filters[nr];
+  uint16_t value = robolib_adc_values[nr];
+  uint8_t i;
 
-  if (temp <= 7) {
-    robolib_adc_values[temp] = ADC;
+  if ((filter->config & 0x30) == ADC_FILTER_IIR(1)) {
+    filter->data.acc = (uint32_t) value << ((filter->config & 0x07) + 1);
+  } else {
+    for (i = 0; i < 5; i++) {
+      filter->data.history[i] = value;
+    }
+  }
+  filter->index = 0;
+  filter->value = value;
+  filter->min   = 0xFFFF;
+  filter->max   = 0x0000;
+}
+#endif
+
+//**************************[robolib_adc_filter_update]************************ 19.10.2026
+// Achtung: wird vom adc-Interrupt aufgerufen!
+#ifdef ADC_FILTER
+void robolib_adc_filter_update(uint8_t nr, uint16_t value) {
+
+  volatile struct robolib_adc_filter* filter = &robolib_adc_filters[nr];
+  uint16_t a, b, c, d, e, temp;
+
+  if (value < filter->min) { filter->min = value;}
+  if (value > filter->max) { filter->max = value;}
+
+  switch (filter->config & 0x30) {
+    case ADC_FILTER_IIR(1):
+      {
+        // y = y + (x - y) / 2^shift  (acc = y * 2^shift)
+        uint8_t  shift = (filter->config & 0x07) + 1;
+        uint32_t acc   = filter->data.acc;
+        acc = acc - (acc >> shift) + value;
+        filter->data.acc = acc;
+        filter->value    = acc >> shift;
+      }
+      break;
+
+    case ADC_FILTER_MEDIAN3:
+      filter->data.history[filter->index] = value;
+      if (++filter->index >= 3) { filter->index = 0;}
+
+      a = filter->data.history[0];
+      b = filter->data.history[1];
+      c = filter->data.history[2];
+      if (a > b) { temp = a; a = b; b = temp;}
+      // median = max(a, min(b, c))
+      if (b > c) { b = c;}
+      filter->value = (a > b) ? a : b;
+      break;
+
+    case ADC_FILTER_MEDIAN5:
+      filter->data.history[filter->index] = value;
+      if (++filter->index >= 5) { filter->index = 0;}
+
+      a = filter->data.history[0];
+      b = filter->data.history[1];
+      c = filter->data.history[2];
+      d = filter->data.history[3];
+      e = filter->data.history[4];
+      // drop the smallest value twice - the median is the smallest of
+      // the remaining three values (6 comparisons)
+      if (a > b) { temp = a; a = b; b = temp;}
+      if (c > d) { temp = c; c = d; d = temp;}
+      if (a > c) { temp = b; b = d; d = temp; c = a;}
+      a = e;
+      if (a > b) { temp = a; a = b; b = temp;}
+      if (a > c) { temp = b; b = d; d = temp; c = a;}
+      filter->value = (b < c) ? b : c;
+      break;
+
+    default:
+      filter->value = value;
+      break;
   }
-  SREG = mSREG;
-
-  return temp;
 }
+#endif
 
-//**************************[robolib_adc_wait]********************************** 16.09.2014
-// Achtung: bei positiven Ausgang bleiben die Interrupts deaktiviert!
-uint8_t robolib_adc_wait(void) {
-  uint8_t mSREG = SREG;
+//**************************[robolib_adc_next]********************************* 19.10.2026
+// Achtung: muss mit deaktivierten Interrupts aufgerufen werden!
+void robolib_adc_next(void) {
 
-  while (1) {
-    cli();
-    if (robolib_adc_adcok()) { return 0xFF;}
-    SREG = mSREG;
+  uint8_t nr;
 
-    if (adc_is_enabled() == 0x00) {
-      return 0x00;
+  // auto trigger - restart the selected channels
+  #ifdef ADC_TRIGGER
+    if ((robolib_adc_single == 0xFF) && (robolib_adc_pending == 0x0000)) {
+      robolib_adc_pending = robolib_adc_trigger_mask;
     }
+  #endif
+
+  // special channel first
+  if (robolib_adc_single != 0xFF) {
+    nr = robolib_adc_single;
+  } else if (robolib_adc_pending == 0x00) {
+    robolib_adc_current = 0xFF;
+    return;
+  } else {
+    // round robin starting behind the last channel
+    nr = robolib_adc_current;
+    do {
+      if (++nr >= ADC_CHANNELS) {
+        nr = 0;
+      }
+    } while ((robolib_adc_pending & ((uint16_t) 1 << nr)) == 0x00);
+    robolib_adc_pending&= ~ ((uint16_t) 1 << nr);
   }
+
+  robolib_adc_current = nr;
+  robolib_adc_setchannel(nr);
 }
 
+//**************************[ISR(ADC_vect)]************************************* 19.10.2026
+ISR(ADC_vect) {
+
+  #ifdef ADC_TRIGGER
+    ROBOLIB_ADC_TRIGGER_CLEAR();
+  #endif
+
+  uint8_t  nr    = robolib_adc_current;
+  #ifdef ADC_8BIT
+    uint16_t value = ADCH;
+  #else
+    uint16_t value = ADC;
+  #endif
+
+  // reference is still settling - measure the same channel again
+  if (robolib_adc_settle && (nr != 0xFF)) {
+    robolib_adc_settle--;
+    robolib_adc_setchannel(nr);
+    return;
+  }
+
+  if (nr < ADC_CHANNELS) {
+    uint16_t mask = (uint16_t) 1 << nr;
+
+    #ifdef ADC_OVERSAMPLING
+      // sum up 4^n samples and shift right by n
+      uint8_t bits = robolib_adc_oversampling[nr];
+      if (bits) {
+        robolib_adc_oversampling_sum[nr]+= value;
+        if (++robolib_adc_oversampling_count[nr] < (1 << (bits << 1))) {
+          // measure the same channel again
+          robolib_adc_pending|= mask;
+          robolib_adc_next();
+          return;
+        }
+        value = robolib_adc_oversampling_sum[nr] >> bits;
+        robolib_adc_oversampling_count[nr] = 0;
+        robolib_adc_oversampling_sum[nr]   = 0;
+      }
+    #endif
+
+    robolib_adc_values[nr] = value;
+    robolib_adc_done|= mask;
+
+    #ifdef ADC_FILTER
+      robolib_adc_filter_update(nr, value);
+    #endif
+
+    #ifdef ADC_AVERAGE
+      if (robolib_adc_average_mask & mask) {
+        uint8_t i = robolib_adc_average_index[nr];
+        robolib_adc_average_sum[nr]+= value - robolib_adc_average_buffer[nr][i];
+        robolib_adc_average_buffer[nr][i] = value;
+        robolib_adc_average_index[nr] = (i + 1) & (ADC_AVERAGE - 1);
+      }
+    #endif
+  } else if (nr != 0xFF) {
+    robolib_adc_single_value = value;
+    robolib_adc_single_done  = 0xFF;
+    robolib_adc_single       = 0xFF;
+  }
+
+  // hooks of other modules (e.g. adc_timer)
+  #ifdef ROBOLIB_ADC_FUNCTION
+    ROBOLIB_ADC_FUNCTION(nr, value);
+  #endif
+
+  robolib_adc_next();
+}
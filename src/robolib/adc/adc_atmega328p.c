@@ -0,0 +1,245 @@
+/******************************************************************************
+* adc/adc_atmega328p.c                                                        *
+* ====================                                                        *
+*                                                                             *
+* Author : Peter Weissig                                                      *
+*                                                                             *
+* For help or bug report please visit:                                        *
+*   https://github.com/RoboAG/avr_robolib                                     *
+******************************************************************************/
+
+//**************************<File version>*************************************
+#define ROBOLIB_ADC_SUB_VERSION \
+  "robolib/adc/adc_atmega328p.c 19.10.2026 V1.6.0"
+
+//**************************<Variables>****************************************
+// source file of sections with disabled interrupts (TICK_LATENCY)
+ROBOLIB_TICK_CLI_FILE()
+
+//**************************<Renaming>*****************************************
+#ifdef ADC_TRIGGER
+    // a new trigger needs a cleared compare flag
+    #if ADC_TRIGGER == TIMER0
+        #define ROBOLIB_ADC_TRIGGER_CLEAR() TIFR0 = _BV(OCF0A)
+    #else
+        #define ROBOLIB_ADC_TRIGGER_CLEAR() TIFR1 = _BV(OCF1B)
+    #endif
+#endif
+
+//**************************[robolib_adc_init]********************************** 19.10.2026
+void robolib_adc_init() {
+
+    // set hardware registers
+    ADMUX  = (ADC_REFERENCE & 0xC0) | ROBOLIB_ADC_ADLAR;
+      // Bit 6-7 (REFSx ) =   ?? reference voltage [ADC_REFERENCE]
+      // Bit 5   (ADLAR ) =    ? left adjusted result [ADC_8BIT]
+      // Bit 4   (-     ) =    0 reserved
+      // Bit 0-3 (MUXx  ) = 0000 select adc-pin 0
+
+    ADCSRA = _BV(ADIE) | ROBOLIB_ADC_ADATE | ROBOLIB_ADC_ADPS;
+      // Bit 7   (ADEN  ) =    0 adc disabled
+      // Bit 6   (ADSC  ) =    0 no conversion (no start)
+      // Bit 5   (ADATE ) =    ? auto trigger [ADC_TRIGGER]
+      // Bit 4   (ADIF  ) =    0 interrupt flag
+      // Bit 3   (ADIE  ) =    1 interrupt enable (conversion complete)
+      // Bit 0-2 (ADPSx ) =  ??? prescaler [ADC_PRESCALER]
+
+    ADCSRB = ROBOLIB_ADC_ADTS;
+      // Bit 6   (ACME  ) =    0 multiplexer for analog comparator disabled
+      // Bit 0-2 (ADTSx ) =  ??? auto trigger source [ADC_TRIGGER]
+
+    // no requests
+    robolib_adc_current = 0xFF;
+    robolib_adc_pending = 0x00;
+    robolib_adc_done    = 0x00;
+    robolib_adc_single  = 0xFF;
+
+    // let the reference settle
+    robolib_adc_settle  = ADC_REFERENCE_SETTLE;
+
+    #ifdef ADC_OVERSAMPLING
+        uint8_t nr;
+        for (nr = 0; nr < ADC_CHANNELS; nr++) {
+            robolib_adc_oversampling[nr] = 0;
+        }
+    #endif
+    #ifdef ADC_AVERAGE
+        robolib_adc_average_mask = 0x00;
+    #endif
+    #ifdef ADC_FILTER
+        uint8_t i;
+        for (i = 0; i < ADC_CHANNELS; i++) {
+            robolib_adc_filters[i].config = ADC_FILTER_NONE;
+            robolib_adc_filter_restart(i);
+        }
+    #endif
+
+    // start timer of the auto trigger
+    #ifdef ADC_TRIGGER
+        robolib_adc_trigger_mask = 0x0000;
+        robolib_adc_trigger_init();
+    #endif
+
+    // start adc
+    adc_enable();
+}
+
+//**************************[robolib_adc_getchannel]**************************** 19.10.2026
+uint8_t robolib_adc_getchannel(void) {
+
+    uint8_t mSREG = SREG;
+    uint8_t temp;
+
+    cli();
+    ROBOLIB_TICK_CLI_BEGIN(mSREG);
+
+    temp = ADMUX;
+    temp&= _BV(MUX3) | _BV(MUX2) | _BV(MUX1) | _BV(MUX0);
+
+    ROBOLIB_TICK_CLI_END(mSREG);
+    SREG = mSREG;
+
+    return temp;
+}
+
+//**************************[robolib_adc_setchannel]**************************** 19.10.2026
+void robolib_adc_setchannel(uint8_t nr) {
+
+    uint8_t mSREG = SREG;
+
+    cli();
+    ROBOLIB_TICK_CLI_BEGIN(mSREG);
+    if (robolib_adc_adcok() == 0x00) {
+        ROBOLIB_TICK_CLI_END(mSREG);
+        SREG = mSREG;
+        return;
+    }
+
+    // channel descriptor => multiplexer
+    if (nr & 0x40) {
+        nr&= 0x0F;
+    } else {
+        nr&= 0x07;
+    }
+    ADMUX = (ADMUX & 0xF0) | nr;
+
+    // start conversion (otherwise started by the timer)
+    #ifndef ADC_TRIGGER
+        ADCSRA|= _BV(ADSC);
+    #endif
+    ROBOLIB_TICK_CLI_END(mSREG);
+    SREG = mSREG;
+}
+
+//**************************[robolib_adc_trigger_init]************************** 19.10.2026
+#ifdef ADC_TRIGGER
+void robolib_adc_trigger_init(void) {
+
+    #if ADC_TRIGGER == TIMER0
+
+        #if   F_CPU / ADC_TRIGGER_RATE / 1024 > 256
+            #error "can't setup adc trigger with TIMER0 - ADC_TRIGGER_RATE is too low"
+
+        #elif F_CPU / ADC_TRIGGER_RATE /  256 > 256
+            #define ROBOLIB_ADC_TRIGGER_CS  0b101
+            #define ROBOLIB_ADC_TRIGGER_DIV 1024
+
+        #elif F_CPU / ADC_TRIGGER_RATE /   64 > 256
+            #define ROBOLIB_ADC_TRIGGER_CS  0b100
+            #define ROBOLIB_ADC_TRIGGER_DIV  256
+
+        #elif F_CPU / ADC_TRIGGER_RATE /    8 > 256
+            #define ROBOLIB_ADC_TRIGGER_CS  0b011
+            #define ROBOLIB_ADC_TRIGGER_DIV   64
+
+        #elif F_CPU / ADC_TRIGGER_RATE /    1 > 256
+            #define ROBOLIB_ADC_TRIGGER_CS  0b010
+            #define ROBOLIB_ADC_TRIGGER_DIV    8
+
+        #else
+            #define ROBOLIB_ADC_TRIGGER_CS  0b001
+            #define ROBOLIB_ADC_TRIGGER_DIV    1
+        #endif
+        #define ROBOLIB_ADC_TRIGGER_MAX ((uint8_t) \
+          ((F_CPU / ROBOLIB_ADC_TRIGGER_DIV + ADC_TRIGGER_RATE / 2) / \
+          ADC_TRIGGER_RATE - 1))
+
+        // 8-bit Timer
+        // Mode 2 (CTC til OCR0A)
+        TIMSK0 = 0x00;
+            // no interrupts - the compare match triggers the adc
+
+        TCCR0A = _BV(WGM01);
+            // Bit 4-7 (COM0xx) = 0000 output mode for A and B
+            // Bit 0-1 (WGM0x ) =  010 select timer mode [WGM02 in TCCR0B]
+
+        TCNT0  = 0;
+            // Timer/Counter Register - current value of timer
+
+        OCR0A  = ROBOLIB_ADC_TRIGGER_MAX;
+            // Output Compare Register A - top for timer (trigger)
+
+        TIFR0  = _BV(OCF0A) | _BV(OCF0B) | _BV(TOV0);
+            // clear all interrupt flags of this timer
+
+        TCCR0B = (ROBOLIB_ADC_TRIGGER_CS & 0x07);
+            // Bit 6-7 (FOC0x ) =   00 force output compare
+            // Bit 3   (WGM02 ) =    0 [see WGM0x in TCCR0A]
+            // Bit 0-2 (CS0x  ) =  ??? [calculated]
+    #else // ADC_TRIGGER == TIMER1
+
+        #if   F_CPU / ADC_TRIGGER_RATE / 1024 > 65536
+            #error "can't setup adc trigger with TIMER1 - ADC_TRIGGER_RATE is too low"
+
+        #elif F_CPU / ADC_TRIGGER_RATE /  256 > 65536
+            #define ROBOLIB_ADC_TRIGGER_CS  0b101
+            #define ROBOLIB_ADC_TRIGGER_DIV 1024
+
+        #elif F_CPU / ADC_TRIGGER_RATE /   64 > 65536
+            #define ROBOLIB_ADC_TRIGGER_CS  0b100
+            #define ROBOLIB_ADC_TRIGGER_DIV  256
+
+        #elif F_CPU / ADC_TRIGGER_RATE /    8 > 65536
+            #define ROBOLIB_ADC_TRIGGER_CS  0b011
+            #define ROBOLIB_ADC_TRIGGER_DIV   64
+
+        #elif F_CPU / ADC_TRIGGER_RATE /    1 > 65536
+            #define ROBOLIB_ADC_TRIGGER_CS  0b010
+            #define ROBOLIB_ADC_TRIGGER_DIV    8
+
+        #else
+            #define ROBOLIB_ADC_TRIGGER_CS  0b001
+            #define ROBOLIB_ADC_TRIGGER_DIV    1
+        #endif
+        #define ROBOLIB_ADC_TRIGGER_MAX ((uint16_t) \
+          ((F_CPU / ROBOLIB_ADC_TRIGGER_DIV + ADC_TRIGGER_RATE / 2) / \
+          ADC_TRIGGER_RATE - 1))
+
+        // 16-bit Timer
+        // Mode 4 (CTC til OCR1A)
+        TIMSK1&= ~(_BV(OCIE1A) | _BV(OCIE1B) | _BV(TOIE1));
+            // no interrupts - the compare match B triggers the adc
+
+        TCCR1A = 0x00;
+            // Bit 2-7 (COM1xx) = 000000 output mode (none)
+            // Bit 0-1 (WGM1x ) =     00 select timer mode [WGM1x in TCCR1B]
+
+        TCNT1  = 0;
+            // Timer/Counter Register - current value of timer
+
+        OCR1A  = ROBOLIB_ADC_TRIGGER_MAX;
+            // Output Compare Register A - top for timer
+
+        OCR1B  = ROBOLIB_ADC_TRIGGER_MAX;
+            // Output Compare Register B - trigger at top
+
+        TIFR1 = _BV(OCF1A) | _BV(OCF1B) | _BV(TOV1);
+            // clear interrupt flags of timer1
+
+        TCCR1B = _BV(WGM12) | (ROBOLIB_ADC_TRIGGER_CS & 0x07);
+            // Bit 6-7 (ICxx1 ) =   00 input capture (unused)
+            // Bit 3-4 (WGM1x ) =   01 select timer mode [WGM1x in TCCR1A]
+            // Bit 0-2 (CS1x  ) =  ??? [calculated]
+    #endif
+}
+#endif
@@ -0,0 +1,277 @@
+/******************************************************************************
+* adc_calib/adc_calib.c                                                       *
+* =====================                                                       *
+*                                                                             *
+* Author : Peter Weissig                                                      *
+*                                                                             *
+* For help or bug report please visit:                                        *
+*   https://github.com/RoboAG/avr_robolib                                     *
+******************************************************************************/
+
+//**************************<File version>*************************************
+#define ROBOLIB_ADC_CALIB_VERSION \
+  "robolib/adc_calib/adc_calib.c 19.10.2026 V1.0.0"
+
+//**************************<Included files>***********************************
+#include <robolib/adc.h>
+#include <robolib/adc_calib.h>
+
+#include <robolib/eeprom.h>
+#include <robolib/string.h>
+#include <robolib/tick.h>
+
+#include <avr/io.h>
+#include <avr/pgmspace.h>
+
+//**************************<Variables>****************************************
+struct adc_calib robolib_adc_calib[ADC_CHANNELS];
+
+// source file of sections with disabled interrupts (TICK_LATENCY)
+ROBOLIB_TICK_CLI_FILE()
+
+//**************************<Prototypes>***************************************
+
+//**************************<Renaming>*****************************************
+#ifndef __DOXYGEN__
+    // marker in front of the calibration within the eeprom
+    // (followed by number of channels, points and shift)
+    #define ROBOLIB_ADC_CALIB_MAGIC 0xCA1B
+
+    #ifndef ADC_CALIB_TABLE_SHIFT
+        #define ADC_CALIB_TABLE_SHIFT 0
+    #endif
+#endif // #ifndef __DOXYGEN__
+
+//**************************[adc_calib_set]************************************ 19.10.2026
+void adc_calib_set(uint8_t nr, const struct adc_calib* calib) {
+
+    if (nr >= ADC_CHANNELS) {
+        return;
+    }
+
+    uint8_t mSREG = SREG;
+    cli();
+    ROBOLIB_TICK_CLI_BEGIN(mSREG);
+
+    robolib_adc_calib[nr] = *calib;
+
+    ROBOLIB_TICK_CLI_END(mSREG);
+    SREG = mSREG;
+}
+
+//**************************[adc_calib_load_flash]***************************** 19.10.2026
+void adc_calib_load_flash(uint8_t nr, const struct adc_calib* calib) {
+
+    if (nr >= ADC_CHANNELS) {
+        return;
+    }
+
+    uint8_t mSREG = SREG;
+    cli();
+    ROBOLIB_TICK_CLI_BEGIN(mSREG);
+
+    memcpy_P(&robolib_adc_calib[nr], calib, sizeof(struct adc_calib));
+
+    ROBOLIB_TICK_CLI_END(mSREG);
+    SREG = mSREG;
+}
+
+//**************************[adc_calib_load_eeprom]**************************** 19.10.2026
+uint8_t adc_calib_load_eeprom(uint16_t adr) {
+
+    eeprom_adress_set(adr);
+    if (eeprom_read_uint16() != ROBOLIB_ADC_CALIB_MAGIC) {
+        return 0x00;
+    }
+    if (eeprom_read() != ADC_CHANNELS) {
+        return 0x00;
+    }
+    if (eeprom_read() != ROBOLIB_ADC_CALIB_TABLE) {
+        return 0x00;
+    }
+    if (eeprom_read() != ADC_CALIB_TABLE_SHIFT) {
+        return 0x00;
+    }
+
+    uint8_t nr;
+    for (nr = 0; nr < ADC_CHANNELS; nr++) {
+        struct adc_calib calib;
+
+        calib.mode   = eeprom_read();
+        calib.offset = eeprom_read_uint16();
+        calib.gain   = eeprom_read_uint16();
+        #ifdef ADC_CALIB_TABLE
+            uint8_t i;
+            for (i = 0; i < ADC_CALIB_TABLE; i++) {
+                calib.table[i] = eeprom_read_uint16();
+            }
+        #endif
+
+        adc_calib_set(nr, &calib);
+    }
+
+    return 0xFF;
+}
+
+//**************************[adc_calib_save_eeprom]**************************** 19.10.2026
+void adc_calib_save_eeprom(uint16_t adr) {
+
+    eeprom_adress_set(adr);
+    eeprom_write_uint16(ROBOLIB_ADC_CALIB_MAGIC);
+    eeprom_write(ADC_CHANNELS);
+    eeprom_write(ROBOLIB_ADC_CALIB_TABLE);
+    eeprom_write(ADC_CALIB_TABLE_SHIFT);
+
+    uint8_t nr;
+    for (nr = 0; nr < ADC_CHANNELS; nr++) {
+        struct adc_calib calib;
+
+        uint8_t mSREG = SREG;
+        cli();
+        ROBOLIB_TICK_CLI_BEGIN(mSREG);
+        calib = robolib_adc_calib[nr];
+        ROBOLIB_TICK_CLI_END(mSREG);
+        SREG = mSREG;
+
+        eeprom_write(calib.mode);
+        eeprom_write_uint16(calib.offset);
+        eeprom_write_uint16(calib.gain);
+        #ifdef ADC_CALIB_TABLE
+            uint8_t i;
+            for (i = 0; i < ADC_CALIB_TABLE; i++) {
+                eeprom_write_uint16(calib.table[i]);
+            }
+        #endif
+    }
+}
+
+//**************************[adc_calib_convert]******************************** 19.10.2026
+int16_t adc_calib_convert(uint8_t nr, uint16_t raw) {
+
+    if (nr >= ADC_CHANNELS) {
+        return (int16_t) raw;
+    }
+
+    struct adc_calib* calib = &robolib_adc_calib[nr];
+    int32_t result;
+
+    uint8_t mSREG = SREG;
+    cli();
+    ROBOLIB_TICK_CLI_BEGIN(mSREG);
+
+    int32_t x = (int32_t) raw - calib->offset;
+
+    #ifdef ADC_CALIB_TABLE
+    if (calib->mode == ADC_CALIB_MODE_TABLE) {
+        // piecewise linear between two points (no division)
+        if (x <= 0) {
+            result = calib->table[0];
+        } else if (x >= ((int32_t) (ADC_CALIB_TABLE - 1) <<
+          ADC_CALIB_TABLE_SHIFT)) {
+            result = calib->table[ADC_CALIB_TABLE - 1];
+        } else {
+            uint8_t  index = (uint8_t) (x >> ADC_CALIB_TABLE_SHIFT);
+            int16_t  low   = calib->table[index];
+            uint16_t frac  = (uint16_t) x &
+              ((1 << ADC_CALIB_TABLE_SHIFT) - 1);
+
+            result = low + ((((int32_t) calib->table[index + 1] - low) *
+              frac) >> ADC_CALIB_TABLE_SHIFT);
+        }
+    } else
+    #endif
+    {
+        // gain is fixed point with 8 fractional bits
+        result = (x * calib->gain) >> 8;
+    }
+
+    ROBOLIB_TICK_CLI_END(mSREG);
+    SREG = mSREG;
+
+    if (result > INT16_MAX) {
+        return INT16_MAX;
+    }
+    if (result < INT16_MIN) {
+        return INT16_MIN;
+    }
+    return (int16_t) result;
+}
+
+//**************************[adc_calib_get]************************************ 19.10.2026
+int16_t adc_calib_get(uint8_t nr) {
+
+    return adc_calib_convert(nr, adc_buffer_get(nr));
+}
+
+//**************************[robolib_adc_calib_print]************************** 19.10.2026
+void robolib_adc_calib_print(void (*out)(uint8_t)) {
+
+    string_from_const(out, "adc_calib:"                                "\r\n");
+
+    uint8_t nr;
+    for (nr = 0; nr < ADC_CHANNELS; nr++) {
+        struct adc_calib* calib = &robolib_adc_calib[nr];
+
+        string_from_const(out, "  channel["); string_from_uint(out, nr, 1);
+        string_from_const_length(out, "]", nr < 10 ? 15 - 11 : 15 - 12);
+        string_from_const(out, ": ");
+
+        if (calib->mode == ADC_CALIB_MODE_TABLE) {
+            string_from_const(out, "table  ");
+        } else {
+            string_from_const(out, "linear ");
+        }
+        string_from_int(out, calib->offset, 6);
+        if (calib->mode != ADC_CALIB_MODE_TABLE) {
+            string_from_const(out, " ");
+            string_from_int(out, calib->gain, 6);
+        }
+        string_from_const(out,                                         "\r\n");
+    }
+
+    string_from_const(out,                                             "\r\n");
+}
+
+//**************************[robolib_adc_calib_print_compiled]***************** 19.10.2026
+void robolib_adc_calib_print_compiled(void (*out)(uint8_t)) {
+
+    string_from_const(out, ROBOLIB_ADC_CALIB_VERSION                   "\r\n");
+
+    string_from_const_length(out, "  TABLE", 15); string_from_const(out, ": ");
+    #ifdef ADC_CALIB_TABLE
+        string_from_macro(out, ADC_CALIB_TABLE);
+    #else
+        string_from_const(out, "-");
+    #endif
+                                                string_from_const(out, "\r\n");
+
+    string_from_const_length(out, "  TABLE_SHIFT", 15);
+                                                string_from_const(out, ": ");
+    string_from_macro(out, ADC_CALIB_TABLE_SHIFT);
+                                                string_from_const(out, "\r\n");
+
+    string_from_const_length(out, "  EEPROM", 15); string_from_const(out, ": ");
+    #ifdef ADC_CALIB_EEPROM
+        string_from_macro(out, ADC_CALIB_EEPROM);
+    #else
+        string_from_const(out, "-");
+    #endif
+                                                string_from_const(out, "\r\n");
+
+    string_from_const(out,                                             "\r\n");
+}
+
+//**************************[robolib_adc_calib_init]*************************** 19.10.2026
+void robolib_adc_calib_init() {
+
+    uint8_t nr;
+    for (nr = 0; nr < ADC_CHANNELS; nr++) {
+        robolib_adc_calib[nr].mode   = ADC_CALIB_MODE_LINEAR;
+        robolib_adc_calib[nr].offset = 0;
+        robolib_adc_calib[nr].gain   = 256;
+    }
+
+    #ifdef ADC_CALIB_EEPROM
+        adc_calib_load_eeprom(ADC_CALIB_EEPROM);
+    #endif
+}
@@ -0,0 +1,323 @@
+/******************************************************************************
+* adc_capture/adc_capture.c                                                   *
+* =========================                                                   *
+*                                                                             *
+* Author : Peter Weissig                                                      *
+*                                                                             *
+* For help or bug report please visit:                                        *
+*   https://github.com/RoboAG/avr_robolib                                     *
+******************************************************************************/
+
+//**************************<File version>*************************************
+#define ROBOLIB_ADC_CAPTURE_VERSION \
+  "robolib/adc_capture/adc_capture.c 19.10.2026 V1.0.0"
+
+//**************************<Included files>***********************************
+#include <robolib/adc.h>
+#include <robolib/adc_capture.h>
+
+#include <robolib/string.h>
+#include <robolib/tick.h>
+
+#include <avr/io.h>
+
+//**************************<Variables>****************************************
+// ring buffer (written by the adc interrupt)
+struct adc_capture_sample robolib_adc_capture_buffer[ADC_CAPTURE];
+volatile uint8_t  robolib_adc_capture_head;
+volatile uint8_t  robolib_adc_capture_tail;
+volatile uint8_t  robolib_adc_capture_count;
+volatile uint16_t robolib_adc_capture_lost;
+
+// selected channels and channels of the current trigger
+volatile uint16_t robolib_adc_capture_mask;
+volatile uint16_t robolib_adc_capture_sweep;
+volatile uint16_t robolib_adc_capture_time;
+
+// source file of sections with disabled interrupts (TICK_LATENCY)
+ROBOLIB_TICK_CLI_FILE()
+
+//**************************<Prototypes>***************************************
+
+//**************************<Renaming>*****************************************
+#ifndef __DOXYGEN__
+    #if defined(TICK_SYSTICK) && (TICK_SYSTICK == TIMER1)
+        #error "TIMER1 is used by the systick - adc capture needs TIMER1"
+    #endif
+    #if defined(ADC_TRIGGER) && (ADC_TRIGGER == TIMER1)
+        #error "TIMER1 is used by ADC_TRIGGER - adc capture needs TIMER1"
+    #endif
+    #ifdef _ROBOLIB_MOTOR_H_
+        #error "TIMER1 is used by the motor modul - adc capture needs TIMER1"
+    #endif
+
+    // prescaler of the capture timer (16-bit TIMER1)
+    #if   F_CPU / ADC_CAPTURE_RATE / 1024 > 65536
+        #error "can't setup capture timer - ADC_CAPTURE_RATE is too low"
+
+    #elif F_CPU / ADC_CAPTURE_RATE /  256 > 65536
+        #define ROBOLIB_ADC_CAPTURE_CS  0b101
+        #define ROBOLIB_ADC_CAPTURE_DIV 1024
+
+    #elif F_CPU / ADC_CAPTURE_RATE /   64 > 65536
+        #define ROBOLIB_ADC_CAPTURE_CS  0b100
+        #define ROBOLIB_ADC_CAPTURE_DIV  256
+
+    #elif F_CPU / ADC_CAPTURE_RATE /    8 > 65536
+        #define ROBOLIB_ADC_CAPTURE_CS  0b011
+        #define ROBOLIB_ADC_CAPTURE_DIV   64
+
+    #elif F_CPU / ADC_CAPTURE_RATE /    1 > 65536
+        #define ROBOLIB_ADC_CAPTURE_CS  0b010
+        #define ROBOLIB_ADC_CAPTURE_DIV    8
+
+    #else
+        #define ROBOLIB_ADC_CAPTURE_CS  0b001
+        #define ROBOLIB_ADC_CAPTURE_DIV    1
+    #endif
+    #define ROBOLIB_ADC_CAPTURE_MAX ((uint16_t) \
+      ((F_CPU / ROBOLIB_ADC_CAPTURE_DIV + ADC_CAPTURE_RATE / 2) / \
+      ADC_CAPTURE_RATE - 1))
+#endif // #ifndef __DOXYGEN__
+
+//**************************<Files>********************************************
+#if    defined (__AVR_ATmega2561__) // switch micro controller
+#  include <adc_capture/adc_capture_atmega2561.c>
+#  define MCU atmega2561
+#elif  defined (__AVR_ATmega64__)   // switch micro controller
+#  include <adc_capture/adc_capture_atmega64.c>
+#  define MCU atmega64
+#elif  defined (__AVR_ATmega328P__) // switch micro controller
+#  include <adc_capture/adc_capture_atmega328p.c>
+#  define MCU atmega328p
+#elif  defined (__AVR_ATmega644P__) // switch micro controller
+#  include <adc_capture/adc_capture_atmega644p.c>
+#  define MCU atmega644p
+#else                               // switch micro controller
+#  error "device is not supported (yet)"
+#endif                              // switch micro controller
+
+//**************************[adc_capture_start]******************************** 19.10.2026
+void adc_capture_start(uint16_t mask) {
+
+    uint8_t mSREG = SREG;
+    cli();
+    ROBOLIB_TICK_CLI_BEGIN(mSREG);
+
+    robolib_adc_capture_timer_stop();
+
+    robolib_adc_capture_head  = 0;
+    robolib_adc_capture_tail  = 0;
+    robolib_adc_capture_count = 0;
+    robolib_adc_capture_lost  = 0;
+
+    robolib_adc_capture_mask  = mask &
+      (((uint16_t) 0xFFFF) >> (16 - ADC_CHANNELS));
+    robolib_adc_capture_sweep = 0x0000;
+    robolib_adc_capture_time  = 0;
+
+    if (robolib_adc_capture_mask) {
+        robolib_adc_capture_timer_start();
+    }
+
+    ROBOLIB_TICK_CLI_END(mSREG);
+    SREG = mSREG;
+}
+
+//**************************[adc_capture_stop]********************************* 19.10.2026
+void adc_capture_stop(void) {
+
+    uint8_t mSREG = SREG;
+    cli();
+    ROBOLIB_TICK_CLI_BEGIN(mSREG);
+
+    robolib_adc_capture_timer_stop();
+    robolib_adc_capture_mask  = 0x0000;
+    robolib_adc_capture_sweep = 0x0000;
+
+    ROBOLIB_TICK_CLI_END(mSREG);
+    SREG = mSREG;
+}
+
+//**************************[adc_capture_is_running]*************************** 19.10.2026
+uint8_t adc_capture_is_running(void) {
+
+    uint8_t result;
+    uint8_t mSREG = SREG;
+
+    cli();
+    ROBOLIB_TICK_CLI_BEGIN(mSREG);
+    result = (robolib_adc_capture_mask != 0x0000) ? 0xFF : 0x00;
+    ROBOLIB_TICK_CLI_END(mSREG);
+    SREG = mSREG;
+
+    return result;
+}
+
+//**************************[adc_capture_count_get]**************************** 19.10.2026
+uint8_t adc_capture_count_get(void) {
+
+    return robolib_adc_capture_count;
+}
+
+//**************************[adc_capture_block_get]**************************** 19.10.2026
+uint8_t adc_capture_block_get(struct adc_capture_sample** block) {
+
+    uint8_t result;
+    uint8_t mSREG = SREG;
+
+    cli();
+    ROBOLIB_TICK_CLI_BEGIN(mSREG);
+    *block = &robolib_adc_capture_buffer[robolib_adc_capture_tail];
+
+    // only up to the end of the ring buffer
+    result = ADC_CAPTURE - robolib_adc_capture_tail;
+    if (result > robolib_adc_capture_count) {
+        result = robolib_adc_capture_count;
+    }
+    ROBOLIB_TICK_CLI_END(mSREG);
+    SREG = mSREG;
+
+    return result;
+}
+
+//**************************[adc_capture_block_release]************************ 19.10.2026
+void adc_capture_block_release(uint8_t count) {
+
+    uint8_t mSREG = SREG;
+    cli();
+    ROBOLIB_TICK_CLI_BEGIN(mSREG);
+
+    if (count > robolib_adc_capture_count) {
+        count = robolib_adc_capture_count;
+    }
+    robolib_adc_capture_tail = (robolib_adc_capture_tail + count) &
+      (ADC_CAPTURE - 1);
+    robolib_adc_capture_count-= count;
+
+    ROBOLIB_TICK_CLI_END(mSREG);
+    SREG = mSREG;
+}
+
+//**************************[adc_capture_lost_get]***************************** 19.10.2026
+uint16_t adc_capture_lost_get(void) {
+
+    uint16_t result;
+    uint8_t mSREG = SREG;
+
+    cli();
+    ROBOLIB_TICK_CLI_BEGIN(mSREG);
+    result = robolib_adc_capture_lost;
+    ROBOLIB_TICK_CLI_END(mSREG);
+    SREG = mSREG;
+
+    return result;
+}
+
+//**************************[robolib_adc_capture_print]************************ 19.10.2026
+void robolib_adc_capture_print(void (*out)(uint8_t)) {
+
+    string_from_const(out, "adc_capture:"                              "\r\n");
+
+    string_from_const_length(out, "  running", 15); string_from_const(out, ": ");
+    string_from_bool(out, adc_capture_is_running());
+                                                string_from_const(out, "\r\n");
+
+    string_from_const_length(out, "  mask" , 15); string_from_const(out, ": ");
+    string_from_bits(out, robolib_adc_capture_mask, -ADC_CHANNELS);
+                                                string_from_const(out, "\r\n");
+
+    string_from_const_length(out, "  count", 15); string_from_const(out, ": ");
+    string_from_uint(out, adc_capture_count_get(), 3);
+                                                string_from_const(out, "\r\n");
+
+    string_from_const_length(out, "  lost" , 15); string_from_const(out, ": ");
+    string_from_uint(out, adc_capture_lost_get(), 5);
+                                                string_from_const(out, "\r\n");
+
+    string_from_const(out,                                             "\r\n");
+}
+
+//**************************[robolib_adc_capture_print_compiled]*************** 19.10.2026
+void robolib_adc_capture_print_compiled(void (*out)(uint8_t)) {
+
+    string_from_const(out, ROBOLIB_ADC_CAPTURE_VERSION                  "\r\n");
+    string_from_const(out, ROBOLIB_ADC_CAPTURE_SUB_VERSION              "\r\n");
+
+    string_from_const_length(out, "  MCU" , 15); string_from_const(out, ": ");
+    string_from_macro(out, MCU);                string_from_const(out, "\r\n");
+
+    string_from_const_length(out, "  CAPTURE", 15); string_from_const(out, ": ");
+    string_from_macro(out, ADC_CAPTURE);        string_from_const(out, "\r\n");
+
+    string_from_const_length(out, "  CAPTURE_RATE", 15);
+                                                string_from_const(out, ": ");
+    string_from_macro(out, ADC_CAPTURE_RATE);   string_from_const(out, "\r\n");
+
+    string_from_const(out,                                             "\r\n");
+}
+
+//**************************[robolib_adc_capture_adc]************************** 19.10.2026
+void robolib_adc_capture_adc(uint8_t nr, uint16_t value) {
+
+    // called by the adc interrupt for each conversion
+    if (nr >= ADC_CHANNELS) {
+        return;
+    }
+
+    uint16_t mask = (uint16_t) 1 << nr;
+    if ((robolib_adc_capture_sweep & mask) == 0x0000) {
+        return;
+    }
+    robolib_adc_capture_sweep&= ~ mask;
+
+    if (robolib_adc_capture_count >= ADC_CAPTURE) {
+        robolib_adc_capture_lost++;
+        return;
+    }
+
+    struct adc_capture_sample* sample =
+      &robolib_adc_capture_buffer[robolib_adc_capture_head];
+    sample->time  = robolib_adc_capture_time;
+    sample->nr    = nr;
+    sample->value = value;
+
+    robolib_adc_capture_head = (robolib_adc_capture_head + 1) &
+      (ADC_CAPTURE - 1);
+    robolib_adc_capture_count++;
+}
+
+//**************************[robolib_adc_capture_timer_start]******************
+// siehe controllerspezifische Datei
+
+//**************************[robolib_adc_capture_timer_stop]*******************
+// siehe controllerspezifische Datei
+
+//**************************[robolib_adc_capture_init]************************* 19.10.2026
+void robolib_adc_capture_init() {
+
+    robolib_adc_capture_timer_stop();
+
+    robolib_adc_capture_head  = 0;
+    robolib_adc_capture_tail  = 0;
+    robolib_adc_capture_count = 0;
+    robolib_adc_capture_lost  = 0;
+
+    robolib_adc_capture_mask  = 0x0000;
+    robolib_adc_capture_sweep = 0x0000;
+    robolib_adc_capture_time  = 0;
+}
+
+//**************************[ISR(TIMER1_COMPA_vect)]*************************** 19.10.2026
+ISR(TIMER1_COMPA_vect) {
+
+    robolib_adc_capture_time++;
+
+    // channels of the last trigger, which are still pending, are lost
+    if (robolib_adc_capture_sweep) {
+        robolib_adc_capture_lost++;
+    }
+
+    robolib_adc_capture_sweep = robolib_adc_capture_mask;
+    adc_request_mask(robolib_adc_capture_mask);
+}
@@ -0,0 +1,50 @@
+/******************************************************************************
+* adc_capture/adc_capture_atmega64.c                                          *
+* ==================================                                          *
+*                                                                             *
+* Author : Peter Weissig                                                      *
+*                                                                             *
+* For help or bug report please visit:                                        *
+*   https://github.com/RoboAG/avr_robolib                                     *
+******************************************************************************/
+
+//**************************<File version>*************************************
+#define ROBOLIB_ADC_CAPTURE_SUB_VERSION \
+  "robolib/adc_capture/adc_capture_atmega64.c 19.10.2026 V1.0.0"
+
+//**************************[robolib_adc_capture_timer_start]****************** 19.10.2026
+void robolib_adc_capture_timer_start(void) {
+
+    // 16-bit Timer
+    // Mode 4 (CTC til OCR1A)
+    TCCR1A = 0x00;
+        // Bit 2-7 (COM1xx) = 000000 output mode (none)
+        // Bit 0-1 (WGM1x ) =     00 select timer mode [WGM12 in TCCR1B]
+
+    TCNT1  = 0;
+        // Timer/Counter Register - current value of timer
+
+    OCR1A  = ROBOLIB_ADC_CAPTURE_MAX;
+        // Output Compare Register A - top for timer
+
+    TIFR  = _BV(OCF1A);
+        // clear interrupt flag for compare match A
+
+    TIMSK|= _BV(OCIE1A);
+        // interrupt for compare match A (trigger)
+
+    TCCR1B = _BV(WGM12) | (ROBOLIB_ADC_CAPTURE_CS & 0x07);
+        // Bit 6-7 (ICxx1 ) =   00 input capture (unused)
+        // Bit 3-4 (WGM1x ) =   01 select timer mode [WGM1x in TCCR1A]
+        // Bit 0-2 (CS1x  ) =  ??? [calculated]
+}
+
+//**************************[robolib_adc_capture_timer_stop]******************* 19.10.2026
+void robolib_adc_capture_timer_stop(void) {
+
+    TCCR1B = 0x00;
+        // Bit 0-2 (CS1x  ) =  000 timer stopped
+
+    TIMSK&= ~_BV(OCIE1A);
+        // no interrupt for compare match A
+}
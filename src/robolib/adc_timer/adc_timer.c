@@ -10,71 +10,217 @@
 
 //**************************<File version>*************************************
 #define ROBOLIB_ADC_TIMER_VERSION \
-  "robolib/adc_timer/adc_timer.c 27.09.2015 V1.0.0"
+  "robolib/adc_timer/adc_timer.c 19.10.2026 V1.5.0"
 
 //**************************<Included files>***********************************
 #include <robolib/adc_timer.h>
 
 #include <robolib/adc.h>
 #include <robolib/string.h>
+#include <robolib/tick.h>
 
 #include <avr/io.h>
 
 //**************************<Variables>****************************************
 volatile uint8_t  robolib_adc_timer_nr;
-volatile uint8_t  robolib_adc_timer_mask;
+volatile uint16_t robolib_adc_timer_mask;
+
+#ifndef ADC_TIMER_SCAN
+    // selected channels in order of conversion (rebuilt on mask changes)
+    #ifdef ADC_TIMER_WEIGHTS
+        uint8_t robolib_adc_timer_sequence[ADC_CHANNELS * ADC_TIMER_WEIGHTS];
+        uint8_t robolib_adc_timer_weights[ADC_CHANNELS];
+    #else
+        uint8_t robolib_adc_timer_sequence[ADC_CHANNELS];
+    #endif
+    uint8_t robolib_adc_timer_length;
+    uint8_t robolib_adc_timer_pos;
+
+    // channel, which preempts the rotation (0xFF == none)
+    volatile uint8_t robolib_adc_timer_urgent;
+#endif
+
+#ifdef ADC_TIMER_SCAN
+    // double buffered sweeps (front buffer is read by adc_timer_get)
+    volatile uint16_t robolib_adc_timer_values[2][ADC_CHANNELS];
+    volatile uint8_t  robolib_adc_timer_front;
+    volatile uint16_t robolib_adc_timer_sweep;
+    volatile uint16_t robolib_adc_timer_sweeps;
+    uint8_t           robolib_adc_timer_count;
+#endif
+
+// source file of sections with disabled interrupts (TICK_LATENCY)
+ROBOLIB_TICK_CLI_FILE()
 
 //**************************<Prototypes>***************************************
+void robolib_adc_timer_sequence_update(void);
 
 //**************************<Renaming>*****************************************
 
 //**************************<Files>********************************************
 
-//**************************[adc_timer_mask_set]******************************* 27.09.2015
-void adc_timer_mask_set(uint8_t mask) {
+//**************************[adc_timer_get]************************************ 19.10.2026
+#ifdef ADC_TIMER_SCAN
+uint16_t adc_timer_get(uint8_t nr) {
 
-    robolib_adc_timer_mask = mask;
+    if (nr >= ADC_CHANNELS) {
+        return 0xFFFF;
+    }
+
+    uint16_t result;
+    uint8_t mSREG = SREG;
+
+    cli();
+    ROBOLIB_TICK_CLI_BEGIN(mSREG);
+    result = robolib_adc_timer_values[robolib_adc_timer_front][nr];
+    ROBOLIB_TICK_CLI_END(mSREG);
+    SREG = mSREG;
+
+    return result;
+}
+#endif
+
+//**************************[adc_timer_sweeps_get]***************************** 19.10.2026
+uint16_t adc_timer_sweeps_get(void) {
+
+    #ifdef ADC_TIMER_SCAN
+        uint16_t result;
+        uint8_t mSREG = SREG;
+
+        cli();
+        ROBOLIB_TICK_CLI_BEGIN(mSREG);
+        result = robolib_adc_timer_sweeps;
+        ROBOLIB_TICK_CLI_END(mSREG);
+        SREG = mSREG;
+
+        return result;
+    #else
+        return 0;
+    #endif
+}
+
+//**************************[adc_timer_mask_set]******************************* 19.10.2026
+void adc_timer_mask_set(uint16_t mask) {
+
+    uint8_t mSREG = SREG;
+
+    cli();
+    ROBOLIB_TICK_CLI_BEGIN(mSREG);
+    robolib_adc_timer_mask = mask & (((uint16_t) 0xFFFF) >> (16 - ADC_CHANNELS));
+    robolib_adc_timer_sequence_update();
+    ROBOLIB_TICK_CLI_END(mSREG);
+    SREG = mSREG;
 }
 
-//**************************[adc_timer_mask_get]******************************* 27.09.2015
-uint8_t adc_timer_mask_get(void) {
+//**************************[adc_timer_mask_get]******************************* 19.10.2026
+uint16_t adc_timer_mask_get(void) {
 
-    return robolib_adc_timer_mask;
+    uint16_t result;
+    uint8_t mSREG = SREG;
+
+    cli();
+    ROBOLIB_TICK_CLI_BEGIN(mSREG);
+    result = robolib_adc_timer_mask;
+    ROBOLIB_TICK_CLI_END(mSREG);
+    SREG = mSREG;
+
+    return result;
 }
 
-//**************************[adc_timer_pin_add]******************************** 27.09.2015
+//**************************[adc_timer_pin_add]******************************** 19.10.2026
 void adc_timer_pin_add(uint8_t nr) {
 
     uint8_t mSREG = SREG;
-    if (nr > 7) { return;}
+    if (nr >= ADC_CHANNELS) { return;}
+
+    cli();
+    ROBOLIB_TICK_CLI_BEGIN(mSREG);
+    robolib_adc_timer_mask|= (uint16_t) 1 << nr;
+    robolib_adc_timer_sequence_update();
+    ROBOLIB_TICK_CLI_END(mSREG);
+    SREG = mSREG;
+}
+
+//**************************[adc_timer_pin_remove]***************************** 19.10.2026
+void adc_timer_pin_remove(uint8_t nr) {
+
+    uint8_t mSREG = SREG;
+    if (nr >= ADC_CHANNELS) { return;}
 
     cli();
-    robolib_adc_timer_mask|= 1 << nr;
+    ROBOLIB_TICK_CLI_BEGIN(mSREG);
+    robolib_adc_timer_mask&= ~((uint16_t) 1 << nr);
+    robolib_adc_timer_sequence_update();
+    ROBOLIB_TICK_CLI_END(mSREG);
     SREG = mSREG;
 }
 
-//**************************[adc_timer_pin_remove]***************************** 27.09.2015
-void adc_timer_mask_pin_remove(uint8_t nr) {
+//**************************[adc_timer_weight_set]***************************** 19.10.2026
+#ifdef ADC_TIMER_WEIGHTS
+void adc_timer_weight_set(uint8_t nr, uint8_t weight) {
 
     uint8_t mSREG = SREG;
-    if (nr > 7) { return;}
+    if (nr >= ADC_CHANNELS) { return;}
+
+    if (weight < 1) {
+        weight = 1;
+    } else if (weight > ADC_TIMER_WEIGHTS) {
+        weight = ADC_TIMER_WEIGHTS;
+    }
 
     cli();
-    robolib_adc_timer_mask&= ~(1 << nr);
+    ROBOLIB_TICK_CLI_BEGIN(mSREG);
+    robolib_adc_timer_weights[nr] = weight;
+    robolib_adc_timer_sequence_update();
+    ROBOLIB_TICK_CLI_END(mSREG);
     SREG = mSREG;
 }
+#endif
+
+//**************************[adc_timer_weight_get]***************************** 19.10.2026
+#ifdef ADC_TIMER_WEIGHTS
+uint8_t adc_timer_weight_get(uint8_t nr) {
+
+    if (nr >= ADC_CHANNELS) {
+        return 0;
+    }
+
+    return robolib_adc_timer_weights[nr];
+}
+#endif
+
+//**************************[adc_timer_urgent]********************************* 19.10.2026
+#ifndef ADC_TIMER_SCAN
+void adc_timer_urgent(uint8_t nr) {
 
-//**************************[robolib_adc_timer_print]*************************** 27.09.2015
+    if (nr >= ADC_CHANNELS) { return;}
+
+    robolib_adc_timer_urgent = nr;
+}
+#endif
+
+//**************************[robolib_adc_timer_print]*************************** 19.10.2026
 void robolib_adc_timer_print(void (*out)(uint8_t)) {
 
     string_from_const(out, "adc_timer:"                                "\r\n");
 
     string_from_const_length(out, "  mask" , 15); string_from_const(out, ": ");
-    string_from_bits(out, robolib_adc_timer_mask,-8);
+    string_from_bits(out, adc_timer_mask_get(), -ADC_CHANNELS);
                                                 string_from_const(out, "\r\n");
 
     string_from_const_length(out, "  next" , 15); string_from_const(out, ": ");
-    string_from_uint(out, robolib_adc_timer_nr,1);
+    string_from_uint(out, robolib_adc_timer_nr,2);
+                                                string_from_const(out, "\r\n");
+
+    #ifdef ADC_TIMER_WEIGHTS
+        string_from_const_length(out, "  round", 15);
+                                                string_from_const(out, ": ");
+        string_from_uint(out, robolib_adc_timer_length, 3);
+                                                string_from_const(out, "\r\n");
+    #endif
+
+    string_from_const_length(out, "  sweeps", 15); string_from_const(out, ": ");
+    string_from_uint(out, adc_timer_sweeps_get(), 5);
                                                 string_from_const(out, "\r\n");
 
     string_from_const(out,                                             "\r\n");
@@ -85,59 +231,188 @@ void robolib_adc_timer_print_compiled(void (*out)(uint8_t)) {
 
     string_from_const(out, ROBOLIB_ADC_TIMER_VERSION                    "\r\n");
 
-    string_from_const(out, "  [empty]"                                 "\r\n");
+    string_from_const_length(out, "  SCAN", 15); string_from_const(out, ": ");
+    #ifdef ADC_TIMER_SCAN
+    string_from_macro(out, ADC_TIMER_SCAN);     string_from_const(out, "\r\n");
+    #else
+    string_from_const(out, "[disabled]");       string_from_const(out, "\r\n");
+    #endif
+
+    string_from_const_length(out, "  WEIGHTS", 15); string_from_const(out, ": ");
+    #ifdef ADC_TIMER_WEIGHTS
+    string_from_macro(out, ADC_TIMER_WEIGHTS);  string_from_const(out, "\r\n");
+    #else
+    string_from_const(out, "[disabled]");       string_from_const(out, "\r\n");
+    #endif
 
     string_from_const(out,                                             "\r\n");
 }
 
-//**************************[robolib_adc_timer_tick]**************************** 27.09.2015
+//**************************[robolib_adc_timer_tick]**************************** 19.10.2026
 void robolib_adc_timer_tick() {
 
     uint8_t mSREG = SREG;
 
-    cli();
-    uint8_t old_nr = robolib_adc_savevalue();
-    if (old_nr == 0xFF) {
+    #ifdef ADC_TIMER_SCAN
+        // start a new sweep every ADC_TIMER_SCAN ticks
+        #if ADC_TIMER_SCAN > 1
+            if (++robolib_adc_timer_count < ADC_TIMER_SCAN) {
+                return;
+            }
+            robolib_adc_timer_count = 0;
+        #endif
+
+        // ADC_TIMER_SCAN == 0: sweeps run back-to-back, the systick
+        // only starts the first one (e.g. after changing the mask)
+        cli();
+        ROBOLIB_TICK_CLI_BEGIN(mSREG);
+        if (adc_is_enabled() == 0x00) {
+            // abort sweep - requests were dropped by adc_disable()
+            robolib_adc_timer_sweep = 0x00;
+        } else if (robolib_adc_timer_sweep == 0x00) {
+            robolib_adc_timer_sweep = robolib_adc_timer_mask;
+            adc_request_mask(robolib_adc_timer_mask);
+        }
+        ROBOLIB_TICK_CLI_END(mSREG);
+        SREG = mSREG;
+    #else
+        cli();
+        ROBOLIB_TICK_CLI_BEGIN(mSREG);
+        // urgent channel preempts the rotation
+        if (robolib_adc_timer_urgent != 0xFF) {
+            adc_request(robolib_adc_timer_urgent);
+            robolib_adc_timer_urgent = 0xFF;
+            ROBOLIB_TICK_CLI_END(mSREG);
+            SREG = mSREG;
+            return;
+        }
+
+        // the adc interrupt stores the value of the last channel
+        if (robolib_adc_timer_length == 0) {
+            ROBOLIB_TICK_CLI_END(mSREG);
+            SREG = mSREG;
+            return;
+        }
+
+        uint8_t temp_pos = robolib_adc_timer_pos;
+        robolib_adc_timer_nr = robolib_adc_timer_sequence[temp_pos];
+        if (++temp_pos >= robolib_adc_timer_length) {
+            temp_pos = 0;
+        }
+        robolib_adc_timer_pos = temp_pos;
+
+        adc_request(robolib_adc_timer_nr);
+        ROBOLIB_TICK_CLI_END(mSREG);
         SREG = mSREG;
+    #endif
+}
+
+//**************************[robolib_adc_timer_adc]***************************** 19.10.2026
+#ifdef ADC_TIMER_SCAN
+void robolib_adc_timer_adc(uint8_t nr, uint16_t value) {
+
+    // called by the adc interrupt for each conversion
+    if ((nr >= ADC_CHANNELS) ||
+      ((robolib_adc_timer_sweep & ((uint16_t) 1 << nr)) == 0x0000)) {
         return;
     }
 
-    uint8_t temp_nr = robolib_adc_timer_nr;
-    temp_nr&= 0x07;
+    robolib_adc_timer_values[robolib_adc_timer_front ^ 0x01][nr] = value;
+    robolib_adc_timer_sweep&= ~ ((uint16_t) 1 << nr);
+
+    // sweep complete - swap buffers
+    if (robolib_adc_timer_sweep == 0x00) {
+        robolib_adc_timer_front^= 0x01;
+        robolib_adc_timer_sweeps++;
 
-    if (old_nr == temp_nr) {
-        temp_nr++;
+        #if ADC_TIMER_SCAN == 0
+            robolib_adc_timer_sweep = robolib_adc_timer_mask;
+            adc_request_mask(robolib_adc_timer_mask);
+        #endif
     }
+}
+#endif
+
+//**************************[robolib_adc_timer_sequence_update]**************** 19.10.2026
+void robolib_adc_timer_sequence_update() {
+
+    // Achtung: muss mit deaktivierten Interrupts aufgerufen werden!
+    #if defined(ADC_TIMER_WEIGHTS)
+        uint16_t mask = robolib_adc_timer_mask;
+        uint8_t  acc[ADC_CHANNELS];
+        uint8_t  max = 0;
+        uint8_t  length = 0;
+        uint8_t  nr;
+
+        for (nr = 0; nr < ADC_CHANNELS; nr++) {
+            acc[nr] = 0;
+            if ((mask & ((uint16_t) 1 << nr)) &&
+              (robolib_adc_timer_weights[nr] > max)) {
+                max = robolib_adc_timer_weights[nr];
+            }
+        }
 
-    uint8_t mask = robolib_adc_timer_mask;
-
-    uint8_t temp_mask = 1 << temp_nr;
-    while ((temp_mask & mask) == 0) {
-        temp_nr++;
-        temp_mask = temp_mask << 1;
-        if (temp_mask == 0x00) {
-            temp_mask = 0x01;
-            temp_nr = 0;
-            while ((temp_mask & mask) == 0) {
-                temp_nr++;
-                temp_mask = temp_mask << 1;
-                if (temp_mask == 0x00) {
-                temp_nr = 0;
-                SREG = mSREG;
-                return;
+        // max passes over all channels - each channel is added
+        // weight times, spread evenly (like bresenham)
+        uint8_t pass;
+        for (pass = 0; pass < max; pass++) {
+            for (nr = 0; nr < ADC_CHANNELS; nr++) {
+                if ((mask & ((uint16_t) 1 << nr)) == 0x0000) {
+                    continue;
+                }
+                acc[nr]+= robolib_adc_timer_weights[nr];
+                if (acc[nr] >= max) {
+                    acc[nr]-= max;
+                    robolib_adc_timer_sequence[length++] = nr;
                 }
             }
-            break;
         }
-    }
-    robolib_adc_timer_nr = temp_nr;
-    robolib_adc_setchannel(temp_nr);
-    SREG = mSREG;
+
+        robolib_adc_timer_length = length;
+        robolib_adc_timer_pos    = 0;
+
+    #elif !defined(ADC_TIMER_SCAN)
+        uint16_t mask = robolib_adc_timer_mask;
+        uint8_t  length = 0;
+        uint8_t  pos = 0;
+        uint8_t  nr;
+
+        for (nr = 0; nr < ADC_CHANNELS; nr++) {
+            if (mask & ((uint16_t) 1 << nr)) {
+                // continue with the channel behind the last one
+                if ((nr <= robolib_adc_timer_nr) && (pos == length)) {
+                    pos++;
+                }
+                robolib_adc_timer_sequence[length++] = nr;
+            }
+        }
+
+        robolib_adc_timer_length = length;
+        robolib_adc_timer_pos    = (pos < length) ? pos : 0;
+    #endif
 }
 
-//**************************[robolib_adc_timer_init]**************************** 27.09.2015
+//**************************[robolib_adc_timer_init]**************************** 19.10.2026
 void robolib_adc_timer_init() {
 
     robolib_adc_timer_nr   = 0;
-    robolib_adc_timer_mask = 0b11111111;
+    robolib_adc_timer_mask = ((uint16_t) 0xFFFF) >> (16 - ADC_CHANNELS);
+
+    #ifdef ADC_TIMER_WEIGHTS
+        uint8_t nr;
+        for (nr = 0; nr < ADC_CHANNELS; nr++) {
+            robolib_adc_timer_weights[nr] = 1;
+        }
+    #endif
+    #ifndef ADC_TIMER_SCAN
+        robolib_adc_timer_urgent = 0xFF;
+    #endif
+    robolib_adc_timer_sequence_update();
+
+    #ifdef ADC_TIMER_SCAN
+        robolib_adc_timer_front  = 0;
+        robolib_adc_timer_sweep  = 0x00;
+        robolib_adc_timer_sweeps = 0;
+        robolib_adc_timer_count  = 0;
+    #endif
 }
@@ -0,0 +1,257 @@
+/******************************************************************************
+* adc_window/adc_window.c                                                     *
+* =======================                                                     *
+*                                                                             *
+* Author : Peter Weissig                                                      *
+*                                                                             *
+* For help or bug report please visit:                                        *
+*   https://github.com/RoboAG/avr_robolib                                     *
+******************************************************************************/
+
+//**************************<File version>*************************************
+#define ROBOLIB_ADC_WINDOW_VERSION \
+  "robolib/adc_window/adc_window.c 19.10.2026 V1.0.0"
+
+//**************************<Included files>***********************************
+#include <robolib/adc.h>
+#include <robolib/tick.h>
+#include <robolib/adc_window.h>
+
+#include <robolib/string.h>
+
+#include <avr/io.h>
+
+//**************************<Variables>****************************************
+struct robolib_adc_window {
+    uint16_t low;
+    uint16_t high;
+    uint16_t hysteresis;
+    uint8_t  state;
+    struct adc_window_event event;
+} robolib_adc_windows[ADC_CHANNELS];
+
+// enabled windows and channels with pending events
+volatile uint16_t robolib_adc_window_mask;
+volatile uint16_t robolib_adc_window_events;
+
+void (*robolib_adc_window_callback)(uint8_t, uint8_t);
+
+// source file of sections with disabled interrupts (TICK_LATENCY)
+ROBOLIB_TICK_CLI_FILE()
+
+//**************************<Prototypes>***************************************
+
+//**************************<Renaming>*****************************************
+
+//**************************[adc_window_set]*********************************** 19.10.2026
+void adc_window_set(uint8_t nr, uint16_t low, uint16_t high,
+  uint16_t hysteresis) {
+
+    if (nr >= ADC_CHANNELS) {
+        return;
+    }
+
+    uint8_t mSREG = SREG;
+    cli();
+    ROBOLIB_TICK_CLI_BEGIN(mSREG);
+
+    struct robolib_adc_window* window = &robolib_adc_windows[nr];
+    window->low        = low;
+    window->high       = high;
+    window->hysteresis = hysteresis;
+    window->state      = ADC_WINDOW_INSIDE;
+
+    robolib_adc_window_mask  |=   (uint16_t) 1 << nr;
+    robolib_adc_window_events&= ~((uint16_t) 1 << nr);
+
+    ROBOLIB_TICK_CLI_END(mSREG);
+    SREG = mSREG;
+}
+
+//**************************[adc_window_clear]********************************* 19.10.2026
+void adc_window_clear(uint8_t nr) {
+
+    if (nr >= ADC_CHANNELS) {
+        return;
+    }
+
+    uint8_t mSREG = SREG;
+    cli();
+    ROBOLIB_TICK_CLI_BEGIN(mSREG);
+
+    robolib_adc_windows[nr].state = ADC_WINDOW_INSIDE;
+    robolib_adc_window_mask  &= ~((uint16_t) 1 << nr);
+    robolib_adc_window_events&= ~((uint16_t) 1 << nr);
+
+    ROBOLIB_TICK_CLI_END(mSREG);
+    SREG = mSREG;
+}
+
+//**************************[adc_window_state_get]***************************** 19.10.2026
+uint8_t adc_window_state_get(uint8_t nr) {
+
+    if (nr >= ADC_CHANNELS) {
+        return ADC_WINDOW_INSIDE;
+    }
+
+    return robolib_adc_windows[nr].state;
+}
+
+//**************************[adc_window_events_get]**************************** 19.10.2026
+uint16_t adc_window_events_get(void) {
+
+    uint16_t result;
+    uint8_t mSREG = SREG;
+
+    cli();
+    ROBOLIB_TICK_CLI_BEGIN(mSREG);
+    result = robolib_adc_window_events;
+    ROBOLIB_TICK_CLI_END(mSREG);
+    SREG = mSREG;
+
+    return result;
+}
+
+//**************************[adc_window_event_get]***************************** 19.10.2026
+uint8_t adc_window_event_get(uint8_t nr, struct adc_window_event* event) {
+
+    if (nr >= ADC_CHANNELS) {
+        return 0x00;
+    }
+
+    uint8_t result = 0x00;
+    uint8_t mSREG = SREG;
+    cli();
+    ROBOLIB_TICK_CLI_BEGIN(mSREG);
+
+    if (robolib_adc_window_events & ((uint16_t) 1 << nr)) {
+        robolib_adc_window_events&= ~((uint16_t) 1 << nr);
+        if (event) {
+            *event = robolib_adc_windows[nr].event;
+        }
+        result = 0xFF;
+    }
+
+    ROBOLIB_TICK_CLI_END(mSREG);
+    SREG = mSREG;
+
+    return result;
+}
+
+//**************************[adc_window_callback_set]************************** 19.10.2026
+void adc_window_callback_set(void (*callback)(uint8_t, uint8_t)) {
+
+    uint8_t mSREG = SREG;
+    cli();
+    ROBOLIB_TICK_CLI_BEGIN(mSREG);
+
+    robolib_adc_window_callback = callback;
+
+    ROBOLIB_TICK_CLI_END(mSREG);
+    SREG = mSREG;
+}
+
+//**************************[robolib_adc_window_print]************************* 19.10.2026
+void robolib_adc_window_print(void (*out)(uint8_t)) {
+
+    string_from_const(out, "adc_window:"                               "\r\n");
+
+    string_from_const_length(out, "  events", 15); string_from_const(out, ": ");
+    string_from_bits(out, adc_window_events_get(), -ADC_CHANNELS);
+                                                string_from_const(out, "\r\n");
+
+    uint8_t nr;
+    for (nr = 0; nr < ADC_CHANNELS; nr++) {
+        if ((robolib_adc_window_mask & ((uint16_t) 1 << nr)) == 0x0000) {
+            continue;
+        }
+
+        struct robolib_adc_window* window = &robolib_adc_windows[nr];
+
+        string_from_const(out, "  channel["); string_from_uint(out, nr, 1);
+        string_from_const_length(out, "]", nr < 10 ? 15 - 11 : 15 - 12);
+        string_from_const(out, ": ");
+
+        string_from_uint(out, window->low, 4);  string_from_const(out, " ");
+        string_from_uint(out, window->high, 4); string_from_const(out, " ");
+        string_from_uint(out, window->hysteresis, 4);
+                                                string_from_const(out, " ");
+        if (window->state == ADC_WINDOW_BELOW) {
+            string_from_const(out, "below");
+        } else if (window->state == ADC_WINDOW_ABOVE) {
+            string_from_const(out, "above");
+        } else {
+            string_from_const(out, "inside");
+        }
+        string_from_const(out,                                         "\r\n");
+    }
+
+    string_from_const(out,                                             "\r\n");
+}
+
+//**************************[robolib_adc_window_print_compiled]**************** 19.10.2026
+void robolib_adc_window_print_compiled(void (*out)(uint8_t)) {
+
+    string_from_const(out, ROBOLIB_ADC_WINDOW_VERSION                  "\r\n");
+
+    string_from_const_length(out, "  CHANNELS", 15);
+                                                string_from_const(out, ": ");
+    string_from_macro(out, ADC_CHANNELS);       string_from_const(out, "\r\n");
+
+    string_from_const(out,                                             "\r\n");
+}
+
+//**************************[robolib_adc_window_adc]*************************** 19.10.2026
+void robolib_adc_window_adc(uint8_t nr, uint16_t value) {
+
+    // called by the adc interrupt for each conversion
+    if ((nr >= ADC_CHANNELS) ||
+      ((robolib_adc_window_mask & ((uint16_t) 1 << nr)) == 0x0000)) {
+        return;
+    }
+
+    struct robolib_adc_window* window = &robolib_adc_windows[nr];
+    uint8_t state = window->state;
+
+    if (value < window->low) {
+        state = ADC_WINDOW_BELOW;
+    } else if (value > window->high) {
+        state = ADC_WINDOW_ABOVE;
+    } else if (state == ADC_WINDOW_BELOW) {
+        // back into the window only behind the hysteresis
+        if (value - window->low >= window->hysteresis) {
+            state = ADC_WINDOW_INSIDE;
+        }
+    } else if (state == ADC_WINDOW_ABOVE) {
+        if (window->high - value >= window->hysteresis) {
+            state = ADC_WINDOW_INSIDE;
+        }
+    }
+
+    if (state == window->state) {
+        return;
+    }
+
+    window->state       = state;
+    window->event.state = state;
+    window->event.value = value;
+    window->event.time  = tick_get();
+    robolib_adc_window_events|= (uint16_t) 1 << nr;
+
+    if (robolib_adc_window_callback) {
+        robolib_adc_window_callback(nr, state);
+    }
+}
+
+//**************************[robolib_adc_window_init]************************** 19.10.2026
+void robolib_adc_window_init() {
+
+    robolib_adc_window_mask     = 0x0000;
+    robolib_adc_window_events   = 0x0000;
+    robolib_adc_window_callback = 0;
+
+    uint8_t nr;
+    for (nr = 0; nr < ADC_CHANNELS; nr++) {
+        robolib_adc_windows[nr].state = ADC_WINDOW_INSIDE;
+    }
+}
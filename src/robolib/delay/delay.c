@@ -10,7 +10,7 @@
 
 //**************************<File version>*************************************
 #define ROBOLIB_DELAY_VERSION \
-  "robolib/delay/delay.c 27.09.2015 V1.0.0"
+  "robolib/delay/delay.c 19.10.2026 V1.1.0"
 
 //**************************<Included files>***********************************
 #include <robolib/delay.h>
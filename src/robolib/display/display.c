@@ -10,7 +10,7 @@
 
 //**************************<File version>*************************************
 #define ROBOLIB_DISPLAY_VERSION \
-  "robolib/display/display.c 27.09.2015 V1.0.0"
+  "robolib/display/display.c 19.10.2026 V1.5.0"
 
 //**************************<Included files>***********************************
 #include <robolib/display.h>
@@ -24,27 +24,124 @@
 //**************************<Variables>****************************************
 volatile uint8_t robolib_display_enabled;
 
+#ifdef DISPLAY_ASYNC
+    // queue (written to the display by the systick)
+    uint8_t robolib_display_queue_data[DISPLAY_ASYNC];
+    uint8_t robolib_display_queue_flags[DISPLAY_ASYNC];
+    volatile uint8_t robolib_display_queue_head;
+    volatile uint8_t robolib_display_queue_count;
+    uint8_t robolib_display_queue_timeout;
+#endif
+
+#ifdef DISPLAY_NO_RW
+    // execution time of the last command (no busy flag)
+    uint8_t robolib_display_pending;
+    #ifdef _ROBOLIB_TICK_H_
+        // end of the last command and execution times (in timer steps)
+        uint16_t robolib_display_pending_time;
+        uint16_t robolib_display_steps_short;
+        uint16_t robolib_display_steps_long;
+    #endif
+#endif
+
+#ifdef DISPLAY_PIN_E2
+    // selected enable pin(s) and controller of the cursor
+    uint8_t robolib_display_e;
+    uint8_t robolib_display_controller;
+#endif
+
+// source file of sections with disabled interrupts (TICK_LATENCY)
+#ifdef _ROBOLIB_TICK_H_
+    ROBOLIB_TICK_CLI_FILE()
+#else
+    // tick.h is not included - the display works without the systick
+    #define ROBOLIB_TICK_CLI_BEGIN(mSREG)
+    #define ROBOLIB_TICK_CLI_END(mSREG)
+#endif
+
 //**************************<Prototypes>***************************************
 void robolib_display_pin_e_toggle(void);
+#ifndef DISPLAY_NO_RW
+    uint8_t robolib_display_busy_read(void);
+    uint8_t robolib_display_is_busy(void);
+#endif
 void robolib_display_busy_check(void);
+void robolib_display_out(uint8_t flags, uint8_t data);
+void robolib_display_write_sync(uint8_t flags, uint8_t data);
+#ifdef DISPLAY_ASYNC
+    void robolib_display_flush(void);
+#endif
+void robolib_display_write(uint8_t flags, uint8_t data);
 void robolib_display_cmd(uint8_t data);
 
+//**************************<Renaming>*****************************************
+#ifndef __DOXYGEN__
+    // at least 500ns for each half of the enable pulse (cycle time 1us)
+    #define ROBOLIB_DISPLAY_DELAY_E() delay_cycles(F_CPU / 2000000 + 1)
+
+    // polls of the busy flag for at least 2ms (3 delays per poll)
+    #define ROBOLIB_DISPLAY_BUSY_COUNT ((uint16_t) \
+      ((F_CPU / 500) / (3 * (F_CPU / 2000000 + 1)) + 1))
+
+    // flags of each byte
+    #define ROBOLIB_DISPLAY_FLAG_RS 0x01
+    #define ROBOLIB_DISPLAY_FLAG_E1 0x02
+    #define ROBOLIB_DISPLAY_FLAG_E2 0x04
+    #define ROBOLIB_DISPLAY_FLAG_E  0x06
+
+    // controller(s) of the next byte (DISPLAY_PIN_E2)
+    #ifdef DISPLAY_PIN_E2
+        #define ROBOLIB_DISPLAY_SELECT(flags) (robolib_display_e = \
+          (((flags) & ROBOLIB_DISPLAY_FLAG_E1) ? _BV(DISPLAY_PIN_E ) : 0) | \
+          (((flags) & ROBOLIB_DISPLAY_FLAG_E2) ? _BV(DISPLAY_PIN_E2) : 0))
+        #define ROBOLIB_DISPLAY_CONTROLLER robolib_display_controller
+    #else
+        #define ROBOLIB_DISPLAY_SELECT(flags) ((void) 0)
+        #define ROBOLIB_DISPLAY_CONTROLLER ROBOLIB_DISPLAY_FLAG_E1
+    #endif
+
+    // address of each row
+    #if   (DISPLAY_WIDTH == 20)
+        #define ROBOLIB_DISPLAY_ROW_0 0x00
+        #define ROBOLIB_DISPLAY_ROW_1 0x40
+        #define ROBOLIB_DISPLAY_ROW_2 0x14
+        #define ROBOLIB_DISPLAY_ROW_3 0x54
+    #elif (DISPLAY_WIDTH == 24) || (DISPLAY_WIDTH == 40)
+        // rows 2..3 are within the second controller (if any)
+        #define ROBOLIB_DISPLAY_ROW_0 0x00
+        #define ROBOLIB_DISPLAY_ROW_1 0x40
+        #define ROBOLIB_DISPLAY_ROW_2 0x00
+        #define ROBOLIB_DISPLAY_ROW_3 0x40
+    #else
+        #define ROBOLIB_DISPLAY_ROW_0 0x00
+        #define ROBOLIB_DISPLAY_ROW_1 0x40
+        #define ROBOLIB_DISPLAY_ROW_2 0x10
+        #define ROBOLIB_DISPLAY_ROW_3 0x50
+    #endif
+
+    // execution time of the last command (DISPLAY_NO_RW)
+    #define ROBOLIB_DISPLAY_PENDING_NONE  0x00
+    #define ROBOLIB_DISPLAY_PENDING_SHORT 0x01 // 37us
+    #define ROBOLIB_DISPLAY_PENDING_LONG  0x02 // 1.52ms (clear and home)
+    #define ROBOLIB_DISPLAY_DELAY_SHORT() \
+      delay_cycles((uint32_t) ((uint64_t) F_CPU * 40 / 1000000))
+#endif // #ifndef __DOXYGEN__
+
 //**************************<Files>********************************************
 
-//**************************[robolib_display_pin_e_toggle]********************** 27.09.2015
+//**************************[robolib_display_pin_e_toggle]********************** 19.10.2026
 void robolib_display_pin_e_toggle(void){
 
-    delay_us(1); ROBOLIB_DISPLAY_PIN_SET_E(1);
-    delay_us(1); ROBOLIB_DISPLAY_PIN_SET_E(0);
-    delay_us(1);
+    ROBOLIB_DISPLAY_DELAY_E(); ROBOLIB_DISPLAY_PIN_SET_E(1);
+    ROBOLIB_DISPLAY_DELAY_E(); ROBOLIB_DISPLAY_PIN_SET_E(0);
+    ROBOLIB_DISPLAY_DELAY_E();
 }
 
-//**************************[robolib_display_busy_check]************************ 27.09.2015
-void robolib_display_busy_check(void){
-
-    uint8_t counter = 100;
+//**************************[robolib_display_busy_read]************************* 19.10.2026
+#ifndef DISPLAY_NO_RW
+uint8_t robolib_display_busy_read(void){
 
-    if (robolib_display_enabled == 0x00) {return;}
+    uint8_t result;
 
     ROBOLIB_DISPLAY_PIN_SET_RW(1);
     ROBOLIB_DISPLAY_PIN_SET_RS(0);
@@ -52,8 +149,89 @@ void robolib_display_busy_check(void){
 
     ROBOLIB_DISPLAY_DATA_SET_0();
     ROBOLIB_DISPLAY_DATA_DDR_R();
-    ROBOLIB_DISPLAY_DDR|= _BV(DISPLAY_PIN_RW) |
-      _BV(DISPLAY_PIN_RS) | _BV(DISPLAY_PIN_E );
+    ROBOLIB_DISPLAY_DELAY_E();
+
+    // busy flag is within the upper nibble
+    ROBOLIB_DISPLAY_PIN_SET_E(1);
+    ROBOLIB_DISPLAY_DELAY_E();
+    result = ROBOLIB_DISPLAY_BUSY_GET();
+    ROBOLIB_DISPLAY_PIN_SET_E(0);
+    #ifdef DISPLAY_DATA_8BIT
+        ROBOLIB_DISPLAY_DELAY_E();
+    #else
+        robolib_display_pin_e_toggle();
+    #endif
+
+    ROBOLIB_DISPLAY_PIN_SET_RW(0);
+
+    return result;
+}
+
+//**************************[robolib_display_is_busy]*************************** 19.10.2026
+uint8_t robolib_display_is_busy(void){
+
+    #ifdef DISPLAY_PIN_E2
+        // both controllers must be read one after another
+        uint8_t e = robolib_display_e;
+        uint8_t result = 0x00;
+
+        if (e & _BV(DISPLAY_PIN_E )) {
+            robolib_display_e = _BV(DISPLAY_PIN_E );
+            result = robolib_display_busy_read();
+        }
+        if ((e & _BV(DISPLAY_PIN_E2)) && (result == 0x00)) {
+            robolib_display_e = _BV(DISPLAY_PIN_E2);
+            result = robolib_display_busy_read();
+        }
+
+        robolib_display_e = e;
+        return result;
+    #else
+        return robolib_display_busy_read();
+    #endif
+}
+#endif
+
+//**************************[robolib_display_busy_check]************************ 19.10.2026
+void robolib_display_busy_check(void){
+
+    if (robolib_display_enabled == 0x00) {return;}
+
+#ifdef DISPLAY_NO_RW
+    // no busy flag - wait for the remaining execution time
+    #ifdef _ROBOLIB_TICK_H_
+    if (robolib_display_pending != ROBOLIB_DISPLAY_PENDING_NONE) {
+        uint16_t steps = robolib_display_steps_short;
+        if (robolib_display_pending == ROBOLIB_DISPLAY_PENDING_LONG) {
+            steps = robolib_display_steps_long;
+        }
+
+        // the first step may have started right before the timestamp
+        uint16_t elapsed = robolib_tick_steps_get() -
+          robolib_display_pending_time;
+        if (elapsed <= steps) {
+            if (robolib_display_pending == ROBOLIB_DISPLAY_PENDING_LONG) {
+                while ((uint16_t) (robolib_tick_steps_get() -
+                  robolib_display_pending_time) <= steps) {}
+            } else {
+                // steps of 8-bit timers are too coarse for short waits
+                ROBOLIB_DISPLAY_DELAY_SHORT();
+            }
+        }
+    }
+    #else
+    if (robolib_display_pending == ROBOLIB_DISPLAY_PENDING_LONG) {
+        delay_us_inline(152);
+    } else if (robolib_display_pending == ROBOLIB_DISPLAY_PENDING_SHORT) {
+        ROBOLIB_DISPLAY_DELAY_SHORT();
+    }
+    #endif
+    robolib_display_pending = ROBOLIB_DISPLAY_PENDING_NONE;
+#else
+    uint16_t counter = ROBOLIB_DISPLAY_BUSY_COUNT;
+
+    ROBOLIB_DISPLAY_DDR|= ROBOLIB_DISPLAY_MASK_RW |
+      _BV(DISPLAY_PIN_RS) | ROBOLIB_DISPLAY_MASK_E;
 
     if (robolib_display_enabled >= 5) {
         robolib_display_enabled = 4;
@@ -61,52 +239,121 @@ void robolib_display_busy_check(void){
         robolib_display_enabled--;
     }
 
-    delay_us(1);
-
     while ((robolib_display_enabled != 0xFF) && (--counter)) {
-        ROBOLIB_DISPLAY_PIN_SET_E(1);
-        delay_us(1);
-        if (ROBOLIB_DISPLAY_BUSY_GET() == 0x00) {
+        if (robolib_display_is_busy() == 0x00) {
             robolib_display_enabled = 0xFF;
         }
-        ROBOLIB_DISPLAY_PIN_SET_E(0);
-        robolib_display_pin_e_toggle();
     }
 
-    ROBOLIB_DISPLAY_PIN_SET_RW(0);
     if (robolib_display_enabled == 0x00) {
-        ROBOLIB_DISPLAY_DDR &= (~_BV(DISPLAY_PIN_RW) &
-          ~_BV(DISPLAY_PIN_RS) & ~_BV(DISPLAY_PIN_E ));
+        ROBOLIB_DISPLAY_DDR &= (~ROBOLIB_DISPLAY_MASK_RW &
+          ~_BV(DISPLAY_PIN_RS) & ~ROBOLIB_DISPLAY_MASK_E);
     }
+#endif
 }
 
-//**************************[robolib_display_cmd]******************************* 27.09.2015
-void robolib_display_cmd(uint8_t data){
-
-    robolib_display_busy_check();
-    if (robolib_display_enabled != 0xFF) {return;};
+//**************************[robolib_display_out]******************************* 19.10.2026
+void robolib_display_out(uint8_t flags, uint8_t data){
 
+    ROBOLIB_DISPLAY_PIN_SET_RS(flags & ROBOLIB_DISPLAY_FLAG_RS);
     ROBOLIB_DISPLAY_DATA_DDR_W();
 
-    ROBOLIB_DISPLAY_DATA_SET_H(data);
-    robolib_display_pin_e_toggle();
-    ROBOLIB_DISPLAY_DATA_SET_L(data);
-    robolib_display_pin_e_toggle();
+    #ifdef DISPLAY_DATA_8BIT
+        ROBOLIB_DISPLAY_DATA_SET(data);
+        robolib_display_pin_e_toggle();
+    #else
+        ROBOLIB_DISPLAY_DATA_SET_H(data);
+        robolib_display_pin_e_toggle();
+        ROBOLIB_DISPLAY_DATA_SET_L(data);
+        robolib_display_pin_e_toggle();
+    #endif
+
+    #ifdef DISPLAY_NO_RW
+        if (((flags & ROBOLIB_DISPLAY_FLAG_RS) == 0x00) && (data <= 0x03) &&
+          (data != 0x00)) {
+            robolib_display_pending = ROBOLIB_DISPLAY_PENDING_LONG;
+        } else {
+            robolib_display_pending = ROBOLIB_DISPLAY_PENDING_SHORT;
+        }
+        #ifdef _ROBOLIB_TICK_H_
+            robolib_display_pending_time = robolib_tick_steps_get();
+        #endif
+    #endif
 }
 
-//**************************[display_print]************************************ 27.09.2015
-void display_print(uint8_t data){
+//**************************[robolib_display_write_sync]************************ 19.10.2026
+void robolib_display_write_sync(uint8_t flags, uint8_t data){
 
+    ROBOLIB_DISPLAY_SELECT(flags);
     robolib_display_busy_check();
     if (robolib_display_enabled != 0xFF) {return;};
 
-    ROBOLIB_DISPLAY_PIN_SET_RS(1);
-    ROBOLIB_DISPLAY_DATA_DDR_W();
+    robolib_display_out(flags, data);
+}
 
-    ROBOLIB_DISPLAY_DATA_SET_H(data);
-    robolib_display_pin_e_toggle();
-    ROBOLIB_DISPLAY_DATA_SET_L(data);
-    robolib_display_pin_e_toggle();
+//**************************[robolib_display_flush]***************************** 19.10.2026
+#ifdef DISPLAY_ASYNC
+void robolib_display_flush(void){
+
+    // only called with disabled interrupts (no systick in between)
+    while (robolib_display_queue_count) {
+        uint8_t tail = (robolib_display_queue_head -
+          robolib_display_queue_count) & (DISPLAY_ASYNC - 1);
+        robolib_display_queue_count--;
+
+        robolib_display_write_sync(robolib_display_queue_flags[tail],
+          robolib_display_queue_data[tail]);
+    }
+}
+#endif
+
+//**************************[robolib_display_write]***************************** 19.10.2026
+void robolib_display_write(uint8_t flags, uint8_t data){
+
+    #ifdef DISPLAY_ASYNC
+        // disabled interrupts (e.g. within an interrupt) - the systick can
+        // not empty the queue, so everything is written directly
+        if ((SREG & _BV(SREG_I)) == 0x00) {
+            robolib_display_flush();
+            robolib_display_write_sync(flags, data);
+            return;
+        }
+
+        // wait for free space within the queue (emptied by the systick)
+        while (robolib_display_queue_count >= DISPLAY_ASYNC) {
+            if (robolib_display_enabled == 0x00) {return;}
+        }
+
+        if (robolib_display_enabled == 0x00) {return;}
+
+        uint8_t mSREG = SREG;
+        cli();
+        ROBOLIB_TICK_CLI_BEGIN(mSREG);
+
+        uint8_t head = robolib_display_queue_head;
+        robolib_display_queue_data[head]  = data;
+        robolib_display_queue_flags[head] = flags;
+        robolib_display_queue_head  = (head + 1) & (DISPLAY_ASYNC - 1);
+        robolib_display_queue_count++;
+
+        ROBOLIB_TICK_CLI_END(mSREG);
+        SREG = mSREG;
+    #else
+        robolib_display_write_sync(flags, data);
+    #endif
+}
+
+//**************************[robolib_display_cmd]******************************* 19.10.2026
+void robolib_display_cmd(uint8_t data){
+
+    robolib_display_write(ROBOLIB_DISPLAY_FLAG_E, data);
+}
+
+//**************************[display_print]************************************ 19.10.2026
+void display_print(uint8_t data){
+
+    robolib_display_write(ROBOLIB_DISPLAY_FLAG_RS | ROBOLIB_DISPLAY_CONTROLLER,
+      data);
 }
 
 //**************************[display_clear]************************************ 27.09.2015
@@ -127,25 +374,64 @@ void display_cursor(uint8_t mode){
     robolib_display_cmd(0x0C | (mode & 0x03));
 }
 
-//**************************[display_gotoxy]*********************************** 27.09.2015
+//**************************[display_gotoxy]*********************************** 19.10.2026
 void display_gotoxy(uint8_t x,uint8_t y) {
 
-    x&= 0x0F;
-    if (y & 0x01) {x|= 0x40;}
-    if (y & 0x02) {x|= 0x10;}
-    robolib_display_cmd(0x80 | x);
+    if ((x >= DISPLAY_WIDTH) || (y >= DISPLAY_HEIGHT)) {return;}
+
+    switch (y) {
+        case 0 : x+= ROBOLIB_DISPLAY_ROW_0; break;
+        case 1 : x+= ROBOLIB_DISPLAY_ROW_1; break;
+        case 2 : x+= ROBOLIB_DISPLAY_ROW_2; break;
+        default: x+= ROBOLIB_DISPLAY_ROW_3; break;
+    }
+
+    #ifdef DISPLAY_PIN_E2
+        robolib_display_controller = (y < 2) ?
+          ROBOLIB_DISPLAY_FLAG_E1 : ROBOLIB_DISPLAY_FLAG_E2;
+        robolib_display_write(robolib_display_controller, 0x80 | x);
+    #else
+        robolib_display_cmd(0x80 | x);
+    #endif
 }
 
-//**************************[display_setchar]********************************** 27.09.2015
+//**************************[display_setchar]********************************** 19.10.2026
 void display_setchar(uint8_t adr, uint8_t *data) {
 
     uint8_t a;
     robolib_display_cmd(0x40 | ((adr & 0x07) << 3));
     for (a = 0; a < 8; a++) {
-        display_print(*(data++));
+        // characters are stored within all controllers
+        robolib_display_write(ROBOLIB_DISPLAY_FLAG_RS | ROBOLIB_DISPLAY_FLAG_E,
+          *(data++));
     }
 }
 
+//**************************[display_wait]************************************* 19.10.2026
+void display_wait(void) {
+
+    #ifdef DISPLAY_ASYNC
+        if ((SREG & _BV(SREG_I)) == 0x00) {
+            robolib_display_flush();
+            return;
+        }
+
+        while (robolib_display_queue_count) {
+            if (robolib_display_enabled == 0x00) {return;}
+        }
+    #endif
+}
+
+//**************************[display_count_get]******************************** 19.10.2026
+uint8_t display_count_get(void) {
+
+    #ifdef DISPLAY_ASYNC
+        return robolib_display_queue_count;
+    #else
+        return 0;
+    #endif
+}
+
 //**************************[display_enable]*********************************** 27.09.2015
 void display_enable(void) {
 
@@ -173,6 +459,13 @@ void robolib_display_print(void (*out)(uint8_t)) {
                                                   string_from_const(out, ": ");
     string_from_bool(out, display_is_enabled());string_from_const(out, "\r\n");
 
+    #ifdef DISPLAY_ASYNC
+        string_from_const_length(out, "  queue" , 15);
+                                                  string_from_const(out, ": ");
+        string_from_uint(out, display_count_get(), 3);
+                                                string_from_const(out, "\r\n");
+    #endif
+
     string_from_const(out,                                             "\r\n");
 }
 
@@ -193,7 +486,26 @@ void robolib_display_print_compiled(void (*out)(uint8_t)) {
     string_from_macro(out, DISPLAY_PIN_RS   );  string_from_const(out, "\r\n");
     string_from_const_length(out, "  DISPLAY_PIN_RW"   , 20);
                                                   string_from_const(out, ": ");
-    string_from_macro(out, DISPLAY_PIN_RW   );  string_from_const(out, "\r\n");
+    #ifdef DISPLAY_NO_RW
+        string_from_const(out, "[unused]");     string_from_const(out, "\r\n");
+    #else
+        string_from_macro(out, DISPLAY_PIN_RW);string_from_const(out, "\r\n");
+    #endif
+
+    string_from_const_length(out, "  DISPLAY_PIN_E2"   , 20);
+                                                  string_from_const(out, ": ");
+    #ifdef DISPLAY_PIN_E2
+        string_from_macro(out, DISPLAY_PIN_E2); string_from_const(out, "\r\n");
+    #else
+        string_from_const(out, "[undefined]");  string_from_const(out, "\r\n");
+    #endif
+
+    string_from_const_length(out, "  DISPLAY_WIDTH"    , 20);
+                                                  string_from_const(out, ": ");
+    string_from_macro(out, DISPLAY_WIDTH    );  string_from_const(out, "\r\n");
+    string_from_const_length(out, "  DISPLAY_HEIGHT"   , 20);
+                                                  string_from_const(out, ": ");
+    string_from_macro(out, DISPLAY_HEIGHT   );  string_from_const(out, "\r\n");
 
     string_from_const_length(out, "  DISPLAY_DATA_PORT", 20);
                                                   string_from_const(out, ": ");
@@ -207,42 +519,156 @@ void robolib_display_print_compiled(void (*out)(uint8_t)) {
         string_from_const(out, "[undefined]");  string_from_const(out, "\r\n");
     #endif
 
+    string_from_const_length(out, "  DISPLAY_DATA_8BIT", 20);
+                                                  string_from_const(out, ": ");
+    #ifdef DISPLAY_DATA_8BIT
+        string_from_const(out, "[defined]");    string_from_const(out, "\r\n");
+    #else
+        string_from_const(out, "[undefined]");  string_from_const(out, "\r\n");
+    #endif
+
+    string_from_const_length(out, "  DISPLAY_ASYNC"    , 20);
+                                                  string_from_const(out, ": ");
+    #ifdef DISPLAY_ASYNC
+        string_from_macro(out, DISPLAY_ASYNC);  string_from_const(out, "\r\n");
+    #else
+        string_from_const(out, "[undefined]");  string_from_const(out, "\r\n");
+    #endif
+
     string_from_const(out,                                             "\r\n");
 }
 
-//**************************[robolib_display_init]****************************** 27.09.2015
+//**************************[robolib_display_tick]****************************** 19.10.2026
+#ifdef DISPLAY_ASYNC
+void robolib_display_tick(void) {
+
+    uint8_t burst = DISPLAY_ASYNC_BURST;
+
+    #ifdef DISPLAY_NO_RW
+        // the last tick was 10ms ago - all commands are finished
+        robolib_display_pending = ROBOLIB_DISPLAY_PENDING_NONE;
+    #endif
+
+    while (robolib_display_queue_count && burst--) {
+        if (robolib_display_enabled == 0x00) {
+            robolib_display_queue_count = 0;
+            return;
+        }
+
+        // oldest byte stays within the queue until it is written
+        uint8_t mSREG = SREG;
+        cli();
+        ROBOLIB_TICK_CLI_BEGIN(mSREG);
+        uint8_t tail = (robolib_display_queue_head -
+          robolib_display_queue_count) & (DISPLAY_ASYNC - 1);
+        uint8_t data  = robolib_display_queue_data[tail];
+        uint8_t flags = robolib_display_queue_flags[tail];
+        ROBOLIB_TICK_CLI_END(mSREG);
+        SREG = mSREG;
+
+        ROBOLIB_DISPLAY_SELECT(flags);
+
+    #ifdef DISPLAY_NO_RW
+        // long commands end the burst (continued with the next tick)
+        if (robolib_display_pending == ROBOLIB_DISPLAY_PENDING_LONG) {
+            return;
+        }
+        robolib_display_busy_check();
+    #else
+        // short commands need about 40us - longer ones are retried
+        // with the next tick (e.g. clear needs 1.52ms)
+        uint8_t counter = 30;
+        while (robolib_display_is_busy()) {
+            if (--counter == 0) {
+                // not responding for 10 ticks - disable display
+                if (++robolib_display_queue_timeout >= 10) {
+                    robolib_display_enabled = 0x00;
+                    robolib_display_queue_count = 0;
+                    ROBOLIB_DISPLAY_DDR &= (~ROBOLIB_DISPLAY_MASK_RW &
+                      ~_BV(DISPLAY_PIN_RS) & ~ROBOLIB_DISPLAY_MASK_E);
+                }
+                return;
+            }
+        }
+        robolib_display_queue_timeout = 0;
+    #endif
+
+        mSREG = SREG;
+        cli();
+        ROBOLIB_TICK_CLI_BEGIN(mSREG);
+        robolib_display_queue_count--;
+        ROBOLIB_TICK_CLI_END(mSREG);
+        SREG = mSREG;
+
+        robolib_display_out(flags, data);
+    }
+}
+#endif
+
+//**************************[robolib_display_init]****************************** 19.10.2026
 void robolib_display_init(void) {
 
     robolib_display_enabled = 0xFF;
 
+    #ifdef DISPLAY_PIN_E2
+        // the initialization is done for both controllers
+        robolib_display_e          = ROBOLIB_DISPLAY_MASK_E;
+        robolib_display_controller = ROBOLIB_DISPLAY_FLAG_E1;
+    #endif
+
+    #ifdef DISPLAY_ASYNC
+        robolib_display_queue_head    = 0;
+        robolib_display_queue_count   = 0;
+        robolib_display_queue_timeout = 0;
+    #endif
+
     ROBOLIB_DISPLAY_PIN_SET_RW(0);
     ROBOLIB_DISPLAY_PIN_SET_RS(0);
     ROBOLIB_DISPLAY_PIN_SET_E(0);
     ROBOLIB_DISPLAY_DATA_SET_0();
 
-    ROBOLIB_DISPLAY_DDR    |= _BV(DISPLAY_PIN_RW) |
+    #ifdef DISPLAY_NO_RW
+        // the first command waits for the last step of the reset sequence
+        robolib_display_pending = ROBOLIB_DISPLAY_PENDING_SHORT;
+        #ifdef _ROBOLIB_TICK_H_
+            robolib_display_steps_short = robolib_tick_us_to_steps(37);
+            robolib_display_steps_long  = robolib_tick_us_to_steps(1520);
+            robolib_display_pending_time = robolib_tick_steps_get();
+        #endif
+    #endif
+
+    ROBOLIB_DISPLAY_DDR    |= ROBOLIB_DISPLAY_MASK_RW |
                             _BV(DISPLAY_PIN_RS) |
-                            _BV(DISPLAY_PIN_E );
+                            ROBOLIB_DISPLAY_MASK_E;
 
     ROBOLIB_DISPLAY_DATA_DDR_W();
     delay_ms(15);
 
-    ROBOLIB_DISPLAY_DATA_SET_L(0x03);
+    #ifdef DISPLAY_DATA_8BIT
+        ROBOLIB_DISPLAY_DATA_SET(0x30);
+    #else
+        ROBOLIB_DISPLAY_DATA_SET_L(0x03);
+    #endif
     robolib_display_pin_e_toggle();
-    delay_ms(5);
+    delay_ms_inline(5);
 
     robolib_display_pin_e_toggle();
-    delay_us(150);
+    delay_us_inline(150);
 
     robolib_display_pin_e_toggle();
 
-    ROBOLIB_DISPLAY_PIN_SET_RW(0);
-    ROBOLIB_DISPLAY_DATA_DDR_W();
-    ROBOLIB_DISPLAY_DATA_SET_L(0x02);
-    robolib_display_pin_e_toggle();
+    #ifdef DISPLAY_DATA_8BIT
+        robolib_display_cmd(0x38); // System set     : 8-Bit mode; 2 rows; 5x7 dots
+    #else
+        ROBOLIB_DISPLAY_PIN_SET_RW(0);
+        ROBOLIB_DISPLAY_DATA_DDR_W();
+        ROBOLIB_DISPLAY_DATA_SET_L(0x02);
+        robolib_display_pin_e_toggle();
 
-    robolib_display_cmd(0x28); // System set     : 4-Bit mode; 2 rows; 5x7 dots
+        robolib_display_cmd(0x28); // System set     : 4-Bit mode; 2 rows; 5x7 dots
+    #endif
     robolib_display_cmd(0x06); // Entry Mode set : shift cursor to the right
     robolib_display_cmd(0x0C); // Display on/off : turn on; cursor off; no blinking
     robolib_display_cmd(0x01); // Display clear
+    // with DISPLAY_ASYNC these commands are written by the systick
 }
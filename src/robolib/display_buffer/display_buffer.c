@@ -10,13 +10,14 @@
 
 //**************************<File version>*************************************
 #define ROBOLIB_DISPLAY_VERSION \
-  "robolib/display_buffer/display_buffer.c 27.09.2015 V1.0.0"
+  "robolib/display_buffer/display_buffer.c 19.10.2026 V1.1.0"
 
 //**************************<Included files>***********************************
 #include <robolib/display_buffer.h>
 
 #include <robolib/assembler.h>
 #include <robolib/string.h>
+#include <robolib/tick.h>
 
 #include <avr/io.h>
 
@@ -26,8 +27,23 @@ volatile uint8_t robolib_display_buffer_position;
 volatile uint8_t robolib_display_buffer_buffer[ROBOLIB_DISPLAY_BUFFER_SIZE];
 volatile uint8_t robolib_display_buffer_current[ROBOLIB_DISPLAY_BUFFER_SIZE];
 
+// changed rows (bit 0..3) and cursor (bit 7)
+volatile uint8_t robolib_display_buffer_dirty;
+// position of an interrupted display_buffer_update_part()
+uint8_t robolib_display_buffer_update_pos;
+
+// source file of sections with disabled interrupts (TICK_LATENCY)
+ROBOLIB_TICK_CLI_FILE()
+
 //**************************<Prototypes>***************************************
 
+//**************************<Renaming>*****************************************
+#ifndef __DOXYGEN__
+    #define ROBOLIB_DISPLAY_BUFFER_DIRTY_ROWS \
+      ((uint8_t) ((1 << DISPLAY_BUFFER_HEIGHT) - 1))
+    #define ROBOLIB_DISPLAY_BUFFER_DIRTY_CURSOR 0x80
+#endif // #ifndef __DOXYGEN__
+
 //**************************<Files>********************************************
 
 //**************************[display_buffer_print]***************************** 27.09.2015
@@ -37,14 +53,18 @@ void display_buffer_print(uint8_t data){
     uint8_t pos;
 
     cli();
+    ROBOLIB_TICK_CLI_BEGIN(mSREG);
     pos = robolib_display_buffer_position;
 
     if (pos >= ROBOLIB_DISPLAY_BUFFER_SIZE) {
+        ROBOLIB_TICK_CLI_END(mSREG);
         SREG = mSREG;
         return;
     }
 
     robolib_display_buffer_buffer[pos] = data;
+    robolib_display_buffer_dirty|= (1 << (pos / DISPLAY_BUFFER_WIDTH)) |
+      ROBOLIB_DISPLAY_BUFFER_DIRTY_CURSOR;
 
     if ((pos % DISPLAY_BUFFER_WIDTH) < (DISPLAY_BUFFER_WIDTH - 1)) {
         pos++;
@@ -53,6 +73,7 @@ void display_buffer_print(uint8_t data){
     }
 
     robolib_display_buffer_position = pos;
+    ROBOLIB_TICK_CLI_END(mSREG);
     SREG = mSREG;
 }
 
@@ -63,68 +84,150 @@ void display_buffer_clear(void){
     uint8_t pos;
 
     cli();
+    ROBOLIB_TICK_CLI_BEGIN(mSREG);
 
     for (pos = 0; pos < ROBOLIB_DISPLAY_BUFFER_SIZE; pos++) {
         robolib_display_buffer_buffer[pos] = ' ';
     }
 
+    robolib_display_buffer_dirty = ROBOLIB_DISPLAY_BUFFER_DIRTY_ROWS |
+      ROBOLIB_DISPLAY_BUFFER_DIRTY_CURSOR;
     robolib_display_buffer_position = 0;
+    ROBOLIB_TICK_CLI_END(mSREG);
     SREG = mSREG;
 }
 
-//**************************[display_buffer_gotoxy]**************************** 27.09.2015
+//**************************[display_buffer_gotoxy]**************************** 19.10.2026
 void display_buffer_gotoxy(uint8_t x,uint8_t y) {
 
-    if (x >= DISPLAY_BUFFER_WIDTH) {
-        robolib_display_buffer_position = 0xFF;
-        return;
-    }
-    if (y >= DISPLAY_BUFFER_HEIGHT) {
+    uint8_t mSREG = SREG;
+    cli();
+    ROBOLIB_TICK_CLI_BEGIN(mSREG);
+
+    if ((x >= DISPLAY_BUFFER_WIDTH) || (y >= DISPLAY_BUFFER_HEIGHT)) {
         robolib_display_buffer_position = 0xFF;
-        return;
+    } else {
+        robolib_display_buffer_position = y * DISPLAY_BUFFER_WIDTH + x;
+        robolib_display_buffer_dirty|= ROBOLIB_DISPLAY_BUFFER_DIRTY_CURSOR;
     }
 
-    robolib_display_buffer_position = y * DISPLAY_BUFFER_WIDTH + x;
+    ROBOLIB_TICK_CLI_END(mSREG);
+    SREG = mSREG;
 }
 
-//**************************[display_buffer_update]**************************** 27.09.2015
+//**************************[display_buffer_update]**************************** 19.10.2026
 void display_buffer_update(void){
 
+    while (display_buffer_update_part(0xFF) == 0x00) {
+        if (! display_is_enabled()) {return;}
+    }
+}
+
+//**************************[display_buffer_update_part]*********************** 19.10.2026
+uint8_t display_buffer_update_part(uint8_t count){
+
+    uint8_t mSREG;
     uint8_t gotoxy = 0xFF;
-    uint8_t pos;
+    uint8_t pos = robolib_display_buffer_update_pos;
+    uint8_t dirty = 0x00;
     uint8_t data;
 
-    for (pos = 0; pos < ROBOLIB_DISPLAY_BUFFER_SIZE; pos++) {
+    while (1) {
+        // check row at its beginning (otherwise continue interrupted row)
+        if ((pos % DISPLAY_BUFFER_WIDTH) == 0) {
+            uint8_t mask = 1 << (pos / DISPLAY_BUFFER_WIDTH);
+
+            mSREG = SREG;
+            cli();
+            ROBOLIB_TICK_CLI_BEGIN(mSREG);
+            dirty = robolib_display_buffer_dirty;
+            robolib_display_buffer_dirty&= ~mask;
+            ROBOLIB_TICK_CLI_END(mSREG);
+            SREG = mSREG;
+
+            if ((dirty & ROBOLIB_DISPLAY_BUFFER_DIRTY_ROWS) == 0x00) {
+                break;
+            }
+
+            if ((dirty & mask) == 0x00) {
+                pos+= DISPLAY_BUFFER_WIDTH;
+                if (pos >= ROBOLIB_DISPLAY_BUFFER_SIZE) {pos = 0;}
+                gotoxy = 0xFF;
+                continue;
+            }
+        }
+
         data = robolib_display_buffer_buffer[pos];
 
         if (data == robolib_display_buffer_current[pos]) {
             gotoxy = 0xFF;
-            continue;
+        } else {
+            if (count == 0) {
+                // row is not finished yet
+                robolib_display_buffer_update_pos = pos;
+                return 0x00;
+            }
+            count--;
+
+            if (gotoxy) {
+                display_gotoxy(pos % DISPLAY_BUFFER_WIDTH,
+                  pos / DISPLAY_BUFFER_WIDTH);
+                gotoxy = 0x00;
+            }
+
+            display_print(data);
+            robolib_display_buffer_current[pos] = data;
+
+            mSREG = SREG;
+            cli();
+            ROBOLIB_TICK_CLI_BEGIN(mSREG);
+            robolib_display_buffer_dirty|= ROBOLIB_DISPLAY_BUFFER_DIRTY_CURSOR;
+            ROBOLIB_TICK_CLI_END(mSREG);
+            SREG = mSREG;
         }
 
+        pos++;
         if ((pos % DISPLAY_BUFFER_WIDTH) == 0) {
-            display_gotoxy(0, pos / DISPLAY_BUFFER_WIDTH);
-        } else if (gotoxy) {
-            display_gotoxy(pos % DISPLAY_BUFFER_WIDTH,
-              pos / DISPLAY_BUFFER_WIDTH);
+            gotoxy = 0xFF;
+            if (pos >= ROBOLIB_DISPLAY_BUFFER_SIZE) {pos = 0;}
         }
+    }
 
-        display_print(data);
-        robolib_display_buffer_current[pos] = data;
+    robolib_display_buffer_update_pos = pos;
+
+    // restore cursor only if it was moved
+    if (dirty & ROBOLIB_DISPLAY_BUFFER_DIRTY_CURSOR) {
+        mSREG = SREG;
+        cli();
+        ROBOLIB_TICK_CLI_BEGIN(mSREG);
+        robolib_display_buffer_dirty&= ~ROBOLIB_DISPLAY_BUFFER_DIRTY_CURSOR;
+        pos = robolib_display_buffer_position;
+        ROBOLIB_TICK_CLI_END(mSREG);
+        SREG = mSREG;
 
-        gotoxy = 0x00;
+        if (pos < ROBOLIB_DISPLAY_BUFFER_SIZE) {
+            display_gotoxy(pos % DISPLAY_BUFFER_WIDTH,
+              pos / DISPLAY_BUFFER_WIDTH);
+        }
     }
 
-    pos = robolib_display_buffer_position;
-    display_gotoxy(pos % DISPLAY_BUFFER_WIDTH, pos / DISPLAY_BUFFER_WIDTH);
+    return 0xFF;
 }
 
-//**************************[display_buffer_updateall]************************* 27.09.2015
+//**************************[display_buffer_updateall]************************* 19.10.2026
 void display_buffer_updateall(void){
 
+    uint8_t mSREG = SREG;
     uint8_t pos;
     uint8_t data;
 
+    cli();
+    ROBOLIB_TICK_CLI_BEGIN(mSREG);
+    robolib_display_buffer_dirty = 0x00;
+    ROBOLIB_TICK_CLI_END(mSREG);
+    SREG = mSREG;
+    robolib_display_buffer_update_pos = 0;
+
     for (pos = 0; pos < ROBOLIB_DISPLAY_BUFFER_SIZE; pos++) {
         data = robolib_display_buffer_buffer[pos];
 
@@ -166,6 +269,10 @@ void robolib_display_buffer_print(void (*out)(uint8_t)) {
     }
                                                 string_from_const(out, "\r\n");
 
+    string_from_const_length(out, "  dirty" , 12);string_from_const(out, ": ");
+    string_from_bits(out, robolib_display_buffer_dirty, -8);
+                                                string_from_const(out, "\r\n");
+
     // buffer
     for (nr = 0; nr < DISPLAY_BUFFER_HEIGHT; nr++) {
         string_from_const(out, "  buffer[");
@@ -237,4 +344,7 @@ void robolib_display_buffer_init(void) {
         robolib_display_buffer_buffer[pos] = ' ';
         robolib_display_buffer_current[pos] = ' ';
     }
+
+    robolib_display_buffer_dirty = 0x00;
+    robolib_display_buffer_update_pos = 0;
 }
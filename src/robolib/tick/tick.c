@@ -10,7 +10,7 @@
 
 //**************************<File version>*************************************
 #define ROBOLIB_TICK_VERSION \
-  "robolib/tick/tick.c 20.03.2018 V1.0.1"
+  "robolib/tick/tick.c 19.10.2026 V1.5.0"
 
 //**************************<Included files>***********************************
 #include <robolib/tick.h>
@@ -18,13 +18,212 @@
 #include <robolib/string.h>
 
 #include <avr/io.h>
+#include <avr/sleep.h>
 
 //**************************<Variables>****************************************
 volatile uint16_t robolib_tick_time;
 
+// missed ticks while the hooks of the systick are running
+volatile uint8_t  robolib_tick_hook_missed;
+volatile uint8_t  robolib_tick_hook_first;
+
+// overruns of the hooks
+volatile uint16_t robolib_tick_overrun_count;
+volatile uint8_t  robolib_tick_overrun_hook;
+volatile uint32_t robolib_tick_overrun_max;
+
+#ifdef TICK_LOAD
+    // idle time (counted by tick_idle)
+    volatile uint8_t  robolib_tick_load_sleeping;
+    volatile uint16_t robolib_tick_load_start;
+    volatile uint32_t robolib_tick_load_idle;
+
+    // time within the hooks of the systick
+    volatile uint32_t robolib_tick_load_hooks;
+    volatile uint32_t robolib_tick_load_hooks_last;
+    volatile uint32_t robolib_tick_load_hooks_max;
+
+    // load of the last seconds (in percent)
+    volatile uint8_t  robolib_tick_load_count;
+    volatile uint8_t  robolib_tick_load_index;
+    volatile uint8_t  robolib_tick_load_valid;
+    volatile uint8_t  robolib_tick_load_window[TICK_LOAD_WINDOW];
+#endif
+
+#ifdef TICK_LATENCY
+    // histogram of the latency (bucket n counts 2^(n-1) .. 2^n - 1 steps)
+    volatile uint16_t robolib_tick_latency[17];
+    volatile uint16_t robolib_tick_latency_max;
+
+    // longest section with disabled interrupts
+    uint16_t          robolib_tick_cli_start;
+    uint8_t           robolib_tick_cli_wrap;
+    volatile uint16_t robolib_tick_cli_max;
+    const char*       robolib_tick_cli_file;
+    volatile uint16_t robolib_tick_cli_line;
+#endif
+
+// source file of sections with disabled interrupts (TICK_LATENCY)
+ROBOLIB_TICK_CLI_FILE()
+
 //**************************<Prototypes>***************************************
+uint16_t robolib_tick_steps_to_us(uint32_t steps);
+#ifdef TICK_LOAD
+    void robolib_tick_load_update(uint32_t hooks);
+#endif
 
 //**************************<Renaming>*****************************************
+#ifndef __DOXYGEN__
+    // older devices (e.g. atmega64) have a single compare unit per 8-bit timer
+    // and share their interrupt registers between the timers
+    #if !defined(TIMER0_COMPA_vect)
+        #define TIMER0_COMPA_vect TIMER0_COMP_vect
+    #endif // if !defined(TIMER0_COMPA_vect)
+    #if !defined(TIMER2_COMPA_vect)
+        #define TIMER2_COMPA_vect TIMER2_COMP_vect
+    #endif // if !defined(TIMER2_COMPA_vect)
+    #if !defined(TCCR0A)
+        #define TCCR0A TCCR0
+    #endif // if !defined(TCCR0A)
+    #if !defined(TCCR2A)
+        #define TCCR2A TCCR2
+    #endif // if !defined(TCCR2A)
+    #if !defined(OCR0A)
+        #define OCR0A OCR0
+    #endif // if !defined(OCR0A)
+    #if !defined(OCR2A)
+        #define OCR2A OCR2
+    #endif // if !defined(OCR2A)
+    #if !defined(OCIE0A)
+        #define OCIE0A OCIE0
+    #endif // if !defined(OCIE0A)
+    #if !defined(OCIE2A)
+        #define OCIE2A OCIE2
+    #endif // if !defined(OCIE2A)
+    #if !defined(OCF0A)
+        #define OCF0A OCF0
+    #endif // if !defined(OCF0A)
+    #if !defined(OCF2A)
+        #define OCF2A OCF2
+    #endif // if !defined(OCF2A)
+    #if !defined(TIMSK0)
+        #define TIMSK0 TIMSK
+    #endif // if !defined(TIMSK0)
+    #if !defined(TIMSK1)
+        #define TIMSK1 TIMSK
+    #endif // if !defined(TIMSK1)
+    #if !defined(TIMSK2)
+        #define TIMSK2 TIMSK
+    #endif // if !defined(TIMSK2)
+    #if !defined(TIMSK3)
+        #define TIMSK3 ETIMSK
+    #endif // if !defined(TIMSK3)
+    #if !defined(TIFR0)
+        #define TIFR0 TIFR
+    #endif // if !defined(TIFR0)
+    #if !defined(TIFR1)
+        #define TIFR1 TIFR
+    #endif // if !defined(TIFR1)
+    #if !defined(TIFR2)
+        #define TIFR2 TIFR
+    #endif // if !defined(TIFR2)
+    #if !defined(TIFR3)
+        #define TIFR3 ETIFR
+    #endif // if !defined(TIFR3)
+
+
+    // registers of the selected systick timer
+    #if   TICK_SYSTICK == TIMER0 // switch TICK_SYSTICK
+        #define ROBOLIB_TICK_NAME  "TIMER0"
+        #define ROBOLIB_TICK_TCCRA TCCR0A
+        #define ROBOLIB_TICK_TCCRB TCCR0B
+        #define ROBOLIB_TICK_TCNT  TCNT0
+        #define ROBOLIB_TICK_OCR   OCR0A
+        #define ROBOLIB_TICK_TIMSK TIMSK0
+        #define ROBOLIB_TICK_OCIE  OCIE0A
+        #define ROBOLIB_TICK_TIFR  TIFR0
+        #define ROBOLIB_TICK_OCF   OCF0A
+        #define ROBOLIB_TICK_vect  TIMER0_COMPA_vect
+    #elif TICK_SYSTICK == TIMER1 // switch TICK_SYSTICK
+        #define ROBOLIB_TICK_NAME  "TIMER1"
+        #define ROBOLIB_TICK_TCCRA TCCR1A
+        #define ROBOLIB_TICK_TCCRB TCCR1B
+        #define ROBOLIB_TICK_TCNT  TCNT1
+        #define ROBOLIB_TICK_OCR   OCR1A
+        #define ROBOLIB_TICK_TIMSK TIMSK1
+        #define ROBOLIB_TICK_OCIE  OCIE1A
+        #define ROBOLIB_TICK_TIFR  TIFR1
+        #define ROBOLIB_TICK_OCF   OCF1A
+        #define ROBOLIB_TICK_vect  TIMER1_COMPA_vect
+    #elif TICK_SYSTICK == TIMER2 // switch TICK_SYSTICK
+        #define ROBOLIB_TICK_NAME  "TIMER2"
+        #define ROBOLIB_TICK_TCCRA TCCR2A
+        #define ROBOLIB_TICK_TCCRB TCCR2B
+        #define ROBOLIB_TICK_TCNT  TCNT2
+        #define ROBOLIB_TICK_OCR   OCR2A
+        #define ROBOLIB_TICK_TIMSK TIMSK2
+        #define ROBOLIB_TICK_OCIE  OCIE2A
+        #define ROBOLIB_TICK_TIFR  TIFR2
+        #define ROBOLIB_TICK_OCF   OCF2A
+        #define ROBOLIB_TICK_vect  TIMER2_COMPA_vect
+    #elif TICK_SYSTICK == TIMER3 // switch TICK_SYSTICK
+        #define ROBOLIB_TICK_NAME  "TIMER3"
+        #define ROBOLIB_TICK_TCCRA TCCR3A
+        #define ROBOLIB_TICK_TCCRB TCCR3B
+        #define ROBOLIB_TICK_TCNT  TCNT3
+        #define ROBOLIB_TICK_OCR   OCR3A
+        #define ROBOLIB_TICK_TIMSK TIMSK3
+        #define ROBOLIB_TICK_OCIE  OCIE3A
+        #define ROBOLIB_TICK_TIFR  TIFR3
+        #define ROBOLIB_TICK_OCF   OCF3A
+        #define ROBOLIB_TICK_vect  TIMER3_COMPA_vect
+    #elif TICK_SYSTICK == TIMER4 // switch TICK_SYSTICK
+        #define ROBOLIB_TICK_NAME  "TIMER4"
+        #define ROBOLIB_TICK_TCCRA TCCR4A
+        #define ROBOLIB_TICK_TCCRB TCCR4B
+        #define ROBOLIB_TICK_TCNT  TCNT4
+        #define ROBOLIB_TICK_OCR   OCR4A
+        #define ROBOLIB_TICK_TIMSK TIMSK4
+        #define ROBOLIB_TICK_OCIE  OCIE4A
+        #define ROBOLIB_TICK_TIFR  TIFR4
+        #define ROBOLIB_TICK_OCF   OCF4A
+        #define ROBOLIB_TICK_vect  TIMER4_COMPA_vect
+    #elif TICK_SYSTICK == TIMER5 // switch TICK_SYSTICK
+        #define ROBOLIB_TICK_NAME  "TIMER5"
+        #define ROBOLIB_TICK_TCCRA TCCR5A
+        #define ROBOLIB_TICK_TCCRB TCCR5B
+        #define ROBOLIB_TICK_TCNT  TCNT5
+        #define ROBOLIB_TICK_OCR   OCR5A
+        #define ROBOLIB_TICK_TIMSK TIMSK5
+        #define ROBOLIB_TICK_OCIE  OCIE5A
+        #define ROBOLIB_TICK_TIFR  TIFR5
+        #define ROBOLIB_TICK_OCF   OCF5A
+        #define ROBOLIB_TICK_vect  TIMER5_COMPA_vect
+    #else                        // switch TICK_SYSTICK
+        #error "TICK_SYSTICK must be one of TIMER0 .. TIMER5"
+    #endif                       // switch TICK_SYSTICK
+
+    // clock source of the systick timer
+    #ifdef TICK_ASYNC_CLOCK
+        #define ROBOLIB_TICK_CLOCK TICK_ASYNC_CLOCK
+    #else
+        #define ROBOLIB_TICK_CLOCK F_CPU
+    #endif // #ifdef TICK_ASYNC_CLOCK
+
+    // nesting of the systick interrupt
+    #define ROBOLIB_TICK_ISR ISR(ROBOLIB_TICK_vect)
+    #define ROBOLIB_TICK_ISR_SEI() ( \
+       { ROBOLIB_TICK_TIMSK&= ~ _BV(ROBOLIB_TICK_OCIE); sei();})
+    #define ROBOLIB_TICK_ISR_CLI() ( \
+       { cli(); ROBOLIB_TICK_TIMSK|= _BV(ROBOLIB_TICK_OCIE);})
+
+    // hooks of the systick (hooks of other modules see their headers)
+    #define ROBOLIB_TICK_HOOK_NONE     0
+    #define ROBOLIB_TICK_HOOK_USER     1
+
+    // timer steps per tick (ROBOLIB_TICK_MAX is set by robolib_tick_init)
+    #define ROBOLIB_TICK_PERIOD ((uint16_t) ROBOLIB_TICK_MAX + 1)
+#endif // #ifndef __DOXYGEN__
 
 //**************************<Files>********************************************
 
@@ -37,6 +236,9 @@ volatile uint16_t robolib_tick_time;
 #elif  defined (__AVR_ATmega328P__) // switch micro controller
     #include <tick/tick_atmega328p.c>
     #define MCU atmega328p
+#elif  defined (__AVR_ATmega644P__) // switch micro controller
+    #include <tick/tick_atmega644p.c>
+    #define MCU atmega644p
 #else                               // switch micro controller
     #error "device is not supported (yet)"
 #endif                              // switch micro controller
@@ -55,24 +257,49 @@ void tick_delay(uint16_t mseconds) {
     }
 }
 
-//**************************[tick_get]***************************************** 27.09.2015
+//**************************[tick_sleep]*************************************** 19.10.2026
+void tick_sleep(uint16_t mseconds) {
+
+    // round up and skip the current tick - never returns early
+    uint16_t ticks = mseconds / 10 + 1;
+    if (mseconds % 10) {
+        ticks++;
+    }
+
+    tick_sleep_until(tick_get() + ticks);
+}
+
+//**************************[tick_sleep_until]********************************* 19.10.2026
+void tick_sleep_until(uint16_t time) {
+
+    // signed difference handles the overflow of the systick
+    while ((int16_t) (tick_get() - time) < 0) {
+        tick_idle();
+    }
+}
+
+//**************************[tick_get]***************************************** 19.10.2026
 uint16_t tick_get() {
 
     uint16_t result;
     uint8_t mSREG = SREG;
     cli();
+    ROBOLIB_TICK_CLI_BEGIN(mSREG);
     result = robolib_tick_time;
+    ROBOLIB_TICK_CLI_END(mSREG);
     SREG = mSREG;
 
     return result;
 }
 
-//**************************[tick_reset]*************************************** 27.09.2015
+//**************************[tick_reset]*************************************** 19.10.2026
 void tick_reset() {
 
     uint8_t mSREG = SREG;
     cli();
+    ROBOLIB_TICK_CLI_BEGIN(mSREG);
     robolib_tick_time = 0;
+    ROBOLIB_TICK_CLI_END(mSREG);
     SREG = mSREG;
 }
 
@@ -101,7 +328,150 @@ uint16_t tick_tomsec(uint16_t time) {
     return (time % (uint16_t) 100) * (uint16_t) 10;
 }
 
-//**************************[robolib_tick_print]******************************** 27.09.2015
+//**************************[tick_idle]**************************************** 19.10.2026
+void tick_idle(void) {
+
+    cli();
+    #ifdef TICK_LOAD
+        robolib_tick_load_start = ROBOLIB_TICK_TCNT;
+        robolib_tick_load_sleeping = 0xFF;
+    #endif
+
+    set_sleep_mode(SLEEP_MODE_IDLE);
+    sleep_enable();
+    sei();
+    sleep_cpu();
+    sleep_disable();
+
+    #ifdef TICK_LOAD
+        // if the systick woke us up, it already counted the idle time
+        cli();
+        if (robolib_tick_load_sleeping) {
+            robolib_tick_load_sleeping = 0x00;
+
+            uint16_t now = ROBOLIB_TICK_TCNT;
+            if (now < robolib_tick_load_start) {
+                now+= ROBOLIB_TICK_PERIOD;
+            }
+            robolib_tick_load_idle+= now - robolib_tick_load_start;
+        }
+        sei();
+    #endif
+}
+
+//**************************[tick_load_get]************************************ 19.10.2026
+#ifdef TICK_LOAD
+void tick_load_get(struct tick_load* load) {
+
+    uint8_t  window[TICK_LOAD_WINDOW];
+    uint8_t  valid;
+    uint32_t hooks_last;
+    uint32_t hooks_max;
+    uint8_t  i;
+
+    uint8_t mSREG = SREG;
+    cli();
+    ROBOLIB_TICK_CLI_BEGIN(mSREG);
+    for (i = 0; i < TICK_LOAD_WINDOW; i++) {
+        window[i] = robolib_tick_load_window[i];
+    }
+    valid      = robolib_tick_load_valid;
+    i          = robolib_tick_load_index;
+    hooks_last = robolib_tick_load_hooks_last;
+    hooks_max  = robolib_tick_load_hooks_max;
+    ROBOLIB_TICK_CLI_END(mSREG);
+    SREG = mSREG;
+
+    // minimum, average and maximum of the window
+    load->last = 0;
+    load->min  = 0;
+    load->avg  = 0;
+    load->max  = 0;
+    if (valid > 0) {
+        uint16_t sum = 0;
+
+        // last second (index points to the next entry)
+        if (i == 0) { i = TICK_LOAD_WINDOW;}
+        load->last = window[i - 1];
+
+        load->min = 100;
+        for (i = 0; i < valid; i++) {
+            if (load->min > window[i]) { load->min = window[i];}
+            if (load->max < window[i]) { load->max = window[i];}
+            sum+= window[i];
+        }
+        load->avg = (sum + valid / 2) / valid;
+    }
+
+    // time within hooks (average of 100 ticks)
+    load->hooks_avg = robolib_tick_steps_to_us(hooks_last / 100);
+    load->hooks_max = robolib_tick_steps_to_us(hooks_max);
+}
+#endif
+
+//**************************[tick_load_reset]********************************** 19.10.2026
+#ifdef TICK_LOAD
+void tick_load_reset(void) {
+
+    uint8_t mSREG = SREG;
+    cli();
+    ROBOLIB_TICK_CLI_BEGIN(mSREG);
+    robolib_tick_load_valid     = 0;
+    robolib_tick_load_index     = 0;
+    robolib_tick_load_hooks_max = 0;
+    ROBOLIB_TICK_CLI_END(mSREG);
+    SREG = mSREG;
+}
+#endif
+
+//**************************[tick_overrun_get]********************************* 19.10.2026
+uint16_t tick_overrun_get(void) {
+
+    uint16_t result;
+    uint8_t mSREG = SREG;
+    cli();
+    ROBOLIB_TICK_CLI_BEGIN(mSREG);
+    result = robolib_tick_overrun_count;
+    ROBOLIB_TICK_CLI_END(mSREG);
+    SREG = mSREG;
+
+    return result;
+}
+
+//**************************[tick_overrun_reset]******************************* 19.10.2026
+void tick_overrun_reset(void) {
+
+    uint8_t mSREG = SREG;
+    cli();
+    ROBOLIB_TICK_CLI_BEGIN(mSREG);
+    robolib_tick_overrun_count = 0;
+    robolib_tick_overrun_hook  = ROBOLIB_TICK_HOOK_NONE;
+    robolib_tick_overrun_max   = 0;
+    ROBOLIB_TICK_CLI_END(mSREG);
+    SREG = mSREG;
+}
+
+//**************************[tick_latency_reset]******************************* 19.10.2026
+#ifdef TICK_LATENCY
+void tick_latency_reset(void) {
+
+    uint8_t i;
+
+    // not measured - this section would be the new maximum at once
+    uint8_t mSREG = SREG;
+    cli();
+    for (i = 0; i < 17; i++) {
+        robolib_tick_latency[i] = 0;
+    }
+    robolib_tick_latency_max = 0;
+    robolib_tick_cli_max     = 0;
+    robolib_tick_cli_file    = 0;
+    robolib_tick_cli_line    = 0;
+    SREG = mSREG;
+}
+#endif
+
+//**************************[robolib_tick_print]******************************** 19.10.2026
 void robolib_tick_print(void (*out)(uint8_t)) {
 
     string_from_const(out, "tick:"                                    "\r\n");
@@ -109,10 +479,103 @@ void robolib_tick_print(void (*out)(uint8_t)) {
     string_from_const_length(out, "  tics" , 15); string_from_const(out, ": ");
     string_from_uint(out, robolib_tick_time,5); string_from_const(out, "\r\n");
 
+    uint16_t overrun_count;
+    uint8_t  overrun_hook;
+    uint32_t overrun_max;
+    uint8_t mSREG = SREG;
+    cli();
+    ROBOLIB_TICK_CLI_BEGIN(mSREG);
+    overrun_count = robolib_tick_overrun_count;
+    overrun_hook  = robolib_tick_overrun_hook;
+    overrun_max   = robolib_tick_overrun_max;
+    ROBOLIB_TICK_CLI_END(mSREG);
+    SREG = mSREG;
+
+    string_from_const_length(out, "  overruns", 15); string_from_const(out, ": ");
+    string_from_uint(out, overrun_count, 5);    string_from_const(out, "\r\n");
+    if (overrun_count) {
+        string_from_const_length(out, "  overrun[max]", 15);
+                                                  string_from_const(out, ": ");
+        string_from_uint(out, robolib_tick_steps_to_us(overrun_max), 5);
+        string_from_const(out, " us (");
+        switch (overrun_hook) {
+            #ifdef ROBOLIB_TICK_HOOK_ADC_TIMER
+            case ROBOLIB_TICK_HOOK_ADC_TIMER:
+                string_from_const(out, "adc_timer");         break;
+            #endif
+            #ifdef ROBOLIB_TICK_HOOK_DISPLAY
+            case ROBOLIB_TICK_HOOK_DISPLAY:
+                string_from_const(out, "display");           break;
+            #endif
+            default:
+                string_from_const(out, "tick_userfunction"); break;
+        }
+        string_from_const(out, ")\r\n");
+    }
+
+    #ifdef TICK_LOAD
+    struct tick_load load;
+    tick_load_get(&load);
+
+    string_from_const_length(out, "  load", 15);      string_from_const(out, ": ");
+    string_from_uint(out, load.last, 3);            string_from_const(out, " %\r\n");
+    string_from_const_length(out, "  load[min]", 15); string_from_const(out, ": ");
+    string_from_uint(out, load.min, 3);             string_from_const(out, " %\r\n");
+    string_from_const_length(out, "  load[avg]", 15); string_from_const(out, ": ");
+    string_from_uint(out, load.avg, 3);             string_from_const(out, " %\r\n");
+    string_from_const_length(out, "  load[max]", 15); string_from_const(out, ": ");
+    string_from_uint(out, load.max, 3);             string_from_const(out, " %\r\n");
+    string_from_const_length(out, "  hooks[avg]", 15);string_from_const(out, ": ");
+    string_from_uint(out, load.hooks_avg, 5);      string_from_const(out, " us\r\n");
+    string_from_const_length(out, "  hooks[max]", 15);string_from_const(out, ": ");
+    string_from_uint(out, load.hooks_max, 5);      string_from_const(out, " us\r\n");
+    #endif
+
+    #ifdef TICK_LATENCY
+    uint16_t histogram[17];
+    uint16_t latency_max, cli_max, cli_line;
+    const char* cli_file;
+    uint8_t i;
+
+    cli();
+    ROBOLIB_TICK_CLI_BEGIN(mSREG);
+    for (i = 0; i < 17; i++) {
+        histogram[i] = robolib_tick_latency[i];
+    }
+    latency_max = robolib_tick_latency_max;
+    cli_max     = robolib_tick_cli_max;
+    cli_file    = robolib_tick_cli_file;
+    cli_line    = robolib_tick_cli_line;
+    ROBOLIB_TICK_CLI_END(mSREG);
+    SREG = mSREG;
+
+    string_from_const_length(out, "  latency[max]", 15);
+                                                  string_from_const(out, ": ");
+    string_from_uint(out, robolib_tick_steps_to_us(latency_max), 5);
+                                                string_from_const(out, " us\r\n");
+    for (i = 0; i < 17; i++) {
+        if (histogram[i] == 0) { continue;}
+        string_from_const(out, "  latency<=");
+        string_from_uint(out, robolib_tick_steps_to_us((1UL << i) - 1), 4);
+        string_from_const(out, " us: ");
+        string_from_uint(out, histogram[i], 5); string_from_const(out, "\r\n");
+    }
+
+    string_from_const_length(out, "  cli[max]", 15); string_from_const(out, ": ");
+    string_from_uint(out, robolib_tick_steps_to_us(cli_max), 5);
+                                                string_from_const(out, " us\r\n");
+    string_from_const_length(out, "  cli[pos]", 15); string_from_const(out, ": ");
+    if (cli_file) {
+        string_from_flash(out, cli_file);       string_from_const(out, ":");
+        string_from_uint(out, cli_line, 0);
+    }
+                                                string_from_const(out, "\r\n");
+    #endif
+
     string_from_const(out,                                             "\r\n");
 }
 
-//**************************[robolib_tick_print_compiled]*********************** 27.09.2015
+//**************************[robolib_tick_print_compiled]*********************** 19.10.2026
 void robolib_tick_print_compiled(void (*out)(uint8_t)) {
 
     string_from_const(out, ROBOLIB_TICK_VERSION                        "\r\n");
@@ -126,10 +589,247 @@ void robolib_tick_print_compiled(void (*out)(uint8_t)) {
 
     string_from_const_length(out, "  SYSTICK", 15);
                                                   string_from_const(out, ": ");
-    string_from_macro(out, TICK_SYSTICK);      string_from_const(out, "\r\n");
+    string_from_const(out, ROBOLIB_TICK_NAME); string_from_const(out, "\r\n");
+
+    string_from_const_length(out, "  ASYNC_CLOCK", 15);
+                                                  string_from_const(out, ": ");
+    #ifdef TICK_ASYNC_CLOCK
+    string_from_macro(out, TICK_ASYNC_CLOCK);   string_from_const(out, "\r\n");
+    #else
+    string_from_const(out, "[undefined]");      string_from_const(out, "\r\n");
+    #endif
+
+    string_from_const_length(out, "  LOAD_WINDOW", 15);
+                                                  string_from_const(out, ": ");
+    #ifdef TICK_LOAD
+    string_from_macro(out, TICK_LOAD_WINDOW);   string_from_const(out, "\r\n");
+    #else
+    string_from_const(out, "[disabled]");       string_from_const(out, "\r\n");
+    #endif
+
+    string_from_const_length(out, "  LATENCY", 15);
+                                                  string_from_const(out, ": ");
+    #ifdef TICK_LATENCY
+    string_from_const(out, "[enabled]");        string_from_const(out, "\r\n");
+    #else
+    string_from_const(out, "[disabled]");       string_from_const(out, "\r\n");
+    #endif
 
     string_from_const(out,                                             "\r\n");
 }
 
 //**************************[robolib_tick_init]*********************************
 // siehe controllerspezifische Datei
+
+//**************************[robolib_tick_steps_to_us]************************* 19.10.2026
+uint16_t robolib_tick_steps_to_us(uint32_t steps) {
+
+    // one tick equals 10000 us
+    if (steps < 400000) {
+        steps = steps * 10000 / ROBOLIB_TICK_PERIOD;
+    } else {
+        steps = steps / ROBOLIB_TICK_PERIOD * 10000;
+    }
+
+    if (steps > 0xFFFF) {
+        return 0xFFFF;
+    }
+    return steps;
+}
+
+//**************************[robolib_tick_us_to_steps]************************* 19.10.2026
+uint16_t robolib_tick_us_to_steps(uint16_t useconds) {
+
+    // one tick equals 10000 us
+    return ((uint32_t) useconds * ROBOLIB_TICK_PERIOD + 9999) / 10000;
+}
+
+//**************************[robolib_tick_steps_get]*************************** 19.10.2026
+uint16_t robolib_tick_steps_get(void) {
+
+    uint16_t time;
+    uint16_t steps;
+
+    uint8_t mSREG = SREG;
+    cli();
+    ROBOLIB_TICK_CLI_BEGIN(mSREG);
+    time  = robolib_tick_time;
+    steps = ROBOLIB_TICK_TCNT;
+    // the timer restarted, but the systick was not called yet
+    if (ROBOLIB_TICK_TIFR & _BV(ROBOLIB_TICK_OCF)) {
+        steps = ROBOLIB_TICK_TCNT;
+        time++;
+    }
+    ROBOLIB_TICK_CLI_END(mSREG);
+    SREG = mSREG;
+
+    // the overflow of the systick keeps the differences valid
+    return time * ROBOLIB_TICK_PERIOD + steps;
+}
+
+//**************************[robolib_tick_cli_begin]*************************** 19.10.2026
+#ifdef TICK_LATENCY
+void robolib_tick_cli_begin(uint8_t mSREG) {
+
+    // only the outermost section is measured
+    if ((mSREG & _BV(SREG_I)) == 0x00) {
+        return;
+    }
+
+    robolib_tick_cli_start = ROBOLIB_TICK_TCNT;
+    robolib_tick_cli_wrap  = ROBOLIB_TICK_TIFR & _BV(ROBOLIB_TICK_OCF);
+}
+#endif
+
+//**************************[robolib_tick_cli_end]***************************** 19.10.2026
+#ifdef TICK_LATENCY
+void robolib_tick_cli_end(uint8_t mSREG, const char* file, uint16_t line) {
+
+    // only the outermost section is measured
+    if ((mSREG & _BV(SREG_I)) == 0x00) {
+        return;
+    }
+
+    // the timer restarted if a new compare match is pending
+    uint16_t now = ROBOLIB_TICK_TCNT;
+    if ((now < robolib_tick_cli_start) || ((robolib_tick_cli_wrap == 0x00) &&
+      (ROBOLIB_TICK_TIFR & _BV(ROBOLIB_TICK_OCF)))) {
+        now+= ROBOLIB_TICK_PERIOD;
+    }
+    now-= robolib_tick_cli_start;
+
+    if (robolib_tick_cli_max < now) {
+        robolib_tick_cli_max  = now;
+        robolib_tick_cli_file = file;
+        robolib_tick_cli_line = line;
+    }
+}
+#endif
+
+//**************************[robolib_tick_hook_done]*************************** 19.10.2026
+void robolib_tick_hook_done(uint8_t hook) {
+
+    // the systick interrupt is masked while the hooks are running -
+    // a compare match during the last hook is counted here
+    uint8_t mSREG = SREG;
+    cli();
+    ROBOLIB_TICK_CLI_BEGIN(mSREG);
+    if (ROBOLIB_TICK_TIFR & _BV(ROBOLIB_TICK_OCF)) {
+        ROBOLIB_TICK_TIFR = _BV(ROBOLIB_TICK_OCF);
+        robolib_tick_time++;
+
+        if (robolib_tick_hook_missed == 0) {
+            robolib_tick_hook_first = hook;
+        }
+        if (robolib_tick_hook_missed < 0xFF) {
+            robolib_tick_hook_missed++;
+        }
+        if (robolib_tick_overrun_count < 0xFFFF) {
+            robolib_tick_overrun_count++;
+        }
+    }
+    ROBOLIB_TICK_CLI_END(mSREG);
+    SREG = mSREG;
+}
+
+//**************************[robolib_tick_load_update]************************* 19.10.2026
+#ifdef TICK_LOAD
+void robolib_tick_load_update(uint32_t hooks) {
+
+    // time spent within the hooks of this tick
+    robolib_tick_load_hooks+= hooks;
+    if (robolib_tick_load_hooks_max < hooks) {
+        robolib_tick_load_hooks_max = hooks;
+    }
+
+    // once per second
+    if (++robolib_tick_load_count < 100) {
+        return;
+    }
+    robolib_tick_load_count = 0;
+
+    uint32_t idle = robolib_tick_load_idle;
+    robolib_tick_load_idle = 0;
+    if (idle > 100 * (uint32_t) ROBOLIB_TICK_PERIOD) {
+        idle = 100 * (uint32_t) ROBOLIB_TICK_PERIOD;
+    }
+
+    robolib_tick_load_window[robolib_tick_load_index] = (uint8_t)
+      ((100 * (uint32_t) ROBOLIB_TICK_PERIOD - idle) / ROBOLIB_TICK_PERIOD);
+    if (++robolib_tick_load_index >= TICK_LOAD_WINDOW) {
+        robolib_tick_load_index = 0;
+    }
+    if (robolib_tick_load_valid < TICK_LOAD_WINDOW) {
+        robolib_tick_load_valid++;
+    }
+
+    robolib_tick_load_hooks_last = robolib_tick_load_hooks;
+    robolib_tick_load_hooks = 0;
+}
+#endif
+
+//**************************[ISR(tick)]**************************************** 19.10.2026
+ROBOLIB_TICK_ISR {
+
+    #ifdef TICK_LATENCY
+        // timer steps since compare match
+        uint16_t latency = ROBOLIB_TICK_TCNT;
+        uint8_t bucket = 0;
+        while ((latency >> bucket) && (bucket < 16)) {
+            bucket++;
+        }
+        if (robolib_tick_latency[bucket] < 0xFFFF) {
+            robolib_tick_latency[bucket]++;
+        }
+        if (robolib_tick_latency_max < latency) {
+            robolib_tick_latency_max = latency;
+        }
+    #endif
+
+    robolib_tick_time++;
+
+    // timer value since compare match
+    uint16_t start = ROBOLIB_TICK_TCNT;
+
+    #ifdef TICK_LOAD
+        // count idle time of tick_idle
+        if (robolib_tick_load_sleeping) {
+            robolib_tick_load_sleeping = 0x00;
+            robolib_tick_load_idle+= ROBOLIB_TICK_PERIOD -
+              robolib_tick_load_start + start;
+        }
+    #endif
+
+    // the hooks run with masked systick interrupt - after each hook
+    // further compare matches are counted as missed (robolib_tick_hook_done)
+    robolib_tick_hook_missed = 0;
+    ROBOLIB_TICK_ISR_SEI();
+
+    #ifdef ROBOLIB_TICK_FUNCTION
+        ROBOLIB_TICK_FUNCTION();
+    #endif
+
+    tick_userfunction();
+    robolib_tick_hook_done(ROBOLIB_TICK_HOOK_USER);
+
+    ROBOLIB_TICK_ISR_CLI();
+
+    // time spent within the hooks (a compare match after the last hook is
+    // not missed, since it will be handled right after this routine)
+    uint32_t hooks = robolib_tick_hook_missed;
+    uint16_t now = ROBOLIB_TICK_TCNT;
+    if (ROBOLIB_TICK_TIFR & _BV(ROBOLIB_TICK_OCF)) {
+        hooks++;
+        now = ROBOLIB_TICK_TCNT;
+    }
+    hooks = hooks * ROBOLIB_TICK_PERIOD + now - start;
+
+    if ((robolib_tick_hook_missed > 0) && (robolib_tick_overrun_max < hooks)) {
+        robolib_tick_overrun_max  = hooks;
+        robolib_tick_overrun_hook = robolib_tick_hook_first;
+    }
+
+    #ifdef TICK_LOAD
+        robolib_tick_load_update(hooks);
+    #endif
+}
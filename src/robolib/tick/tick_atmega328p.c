@@ -10,11 +10,15 @@
 
 //**************************<File version>*************************************
 #define ROBOLIB_TICK_SUB_VERSION \
-  "robolib/tick/tick_atmega328p.c 20.03.2018 V1.0.0"
+  "robolib/tick/tick_atmega328p.c 19.10.2026 V1.1.0"
 
-//**************************[tick_init]**************************************** 20.03.2018
+//**************************[tick_init]**************************************** 19.10.2026
 void robolib_tick_init() {
 
+    #if defined(TICK_ASYNC_CLOCK) && (TICK_SYSTICK != TIMER2)
+        #error "TICK_ASYNC_CLOCK is only supported by TIMER2"
+    #endif
+
     #if TICK_SYSTICK == TIMER0 // switch TIMER
 
         #if   F_CPU / 100 / 1024 > 256
@@ -22,32 +26,26 @@ void robolib_tick_init() {
 
         #elif F_CPU / 100 /  256 > 256
             #define ROBOLIB_TICK_CS  0b101
-            #define ROBOLIB_TICK_MAX ((uint8_t) (F_CPU / 100 / 1024))
-
-        #elif F_CPU / 100 /  128 > 256
-            #define ROBOLIB_TICK_CS  0b100
-            #define ROBOLIB_TICK_MAX ((uint8_t) (F_CPU / 100 /  256))
+            #define ROBOLIB_TICK_DIV 1024
 
         #elif F_CPU / 100 /   64 > 256
             #define ROBOLIB_TICK_CS  0b100
-            #define ROBOLIB_TICK_MAX ((uint8_t) (F_CPU / 100 /  256))
-
-        #elif F_CPU / 100 /   32 > 256
-            #define ROBOLIB_TICK_CS  0b100
-            #define ROBOLIB_TICK_MAX ((uint8_t) (F_CPU / 100 /  256))
+            #define ROBOLIB_TICK_DIV  256
 
         #elif F_CPU / 100 /    8 > 256
             #define ROBOLIB_TICK_CS  0b011
-            #define ROBOLIB_TICK_MAX ((uint8_t) (F_CPU / 100 /   64))
+            #define ROBOLIB_TICK_DIV   64
 
         #elif F_CPU / 100 /    1 > 256
             #define ROBOLIB_TICK_CS  0b010
-            #define ROBOLIB_TICK_MAX ((uint8_t) (F_CPU / 100 /    8))
+            #define ROBOLIB_TICK_DIV    8
 
         #else
             #define ROBOLIB_TICK_CS  0b001
-            #define ROBOLIB_TICK_MAX ((uint8_t) (F_CPU / 100 /    1))
+            #define ROBOLIB_TICK_DIV    1
         #endif
+        #define ROBOLIB_TICK_MAX ((uint8_t) \
+          ((F_CPU / ROBOLIB_TICK_DIV + 50) / 100 - 1))
 
         // 8-bit Timer
         // Mode 2 (CTC until OCRA)
@@ -81,29 +79,142 @@ void robolib_tick_init() {
             // Bit 1   (OCF0A ) =    1 interrupt for compare match A (tick)
             // Bit 0   (TOV0  ) =    0 interrupt for overflow
 
-        #define ROBOLIB_TICK_ISR ISR(TIMER0_COMPA_vect)
-        #define ROBOLIB_TICK_ISR_SEI() ( \
-           { TIMSK0&= ~ _BV(OCIE0A); sei();})
-        #define ROBOLIB_TICK_ISR_CLI() ( \
-           { cli(); TIMSK0|= _BV(OCIE0A);})
+    #elif TICK_SYSTICK == TIMER2          // switch TICK_SYSTICK
 
-    #else                                 // switch TICK_SYSTICK
-        #error "timer is not supported (yet) for this device"
-    #endif                                // switch TICK_SYSTICK
-}
+        #if   ROBOLIB_TICK_CLOCK / 100 / 1024 > 256
+            #error "can't setup systick with TIMER2 - prescaler maximum is 1024"
+
+        #elif ROBOLIB_TICK_CLOCK / 100 /  256 > 256
+            #define ROBOLIB_TICK_CS  0b111
+            #define ROBOLIB_TICK_DIV 1024
+
+        #elif ROBOLIB_TICK_CLOCK / 100 /  128 > 256
+            #define ROBOLIB_TICK_CS  0b110
+            #define ROBOLIB_TICK_DIV  256
+
+        #elif ROBOLIB_TICK_CLOCK / 100 /   64 > 256
+            #define ROBOLIB_TICK_CS  0b101
+            #define ROBOLIB_TICK_DIV  128
+
+        #elif ROBOLIB_TICK_CLOCK / 100 /   32 > 256
+            #define ROBOLIB_TICK_CS  0b100
+            #define ROBOLIB_TICK_DIV   64
+
+        #elif ROBOLIB_TICK_CLOCK / 100 /    8 > 256
+            #define ROBOLIB_TICK_CS  0b011
+            #define ROBOLIB_TICK_DIV   32
+
+        #elif ROBOLIB_TICK_CLOCK / 100 /    1 > 256
+            #define ROBOLIB_TICK_CS  0b010
+            #define ROBOLIB_TICK_DIV    8
+
+        #else
+            #define ROBOLIB_TICK_CS  0b001
+            #define ROBOLIB_TICK_DIV    1
+        #endif
+        #define ROBOLIB_TICK_MAX ((uint8_t) \
+          ((ROBOLIB_TICK_CLOCK / ROBOLIB_TICK_DIV + 50) / 100 - 1))
+
+        TIMSK2 = 0x00;
+            // disable all interrupts while (re-)configuring the timer
+
+        // 8-bit Timer (asynchronous)
+        #ifdef TICK_ASYNC_CLOCK
+            ASSR = _BV(AS2);
+        #else
+            ASSR = 0x00;
+        #endif
+            // Bit 6   (EXCLK ) =    0 crystal oscillator (no external clock)
+            // Bit 5   (AS2   ) =    ? clocked from TOSC1 [TICK_ASYNC_CLOCK]
+            // Bit 0-4 (..UB  ) =      busy flags (read only)
+
+        // Mode 2 (CTC til OCRA)
+        TCCR2A =  _BV(WGM21);
+            // Bit 4-7 (COM2xx) = 0000 output mode for A and B
+            // Bit 0-1 (WGM2x ) =  010 select timer mode [WGM22 in TCCR2B]
 
-//**************************[ISR(tick)]**************************************** 20.03.2018
-ROBOLIB_TICK_ISR {
+        TCCR2B =  (ROBOLIB_TICK_CS & 0x07);
+            // Bit 6-7 (FOC2x ) =   00 force output compare
+            // Bit 3   (WGM22 ) =    0 [see WGM2x in TCCR2A]
+            // Bit 0-2 (CS2x  ) =  ??? [calculated]
 
-    robolib_tick_time++;
+        TCNT2 = 0;
+            // Timer/Counter Register - current value of timer
+
+        OCR2A = ROBOLIB_TICK_MAX;
+            // Output Compare Register A - top for timer
+
+        OCR2B = 0;
+            // Output Compare Register B - unused
+
+        #ifdef TICK_ASYNC_CLOCK
+            // wait until all registers are transferred to the async domain
+            while (ASSR & (_BV(TCN2UB) | _BV(OCR2AUB) | _BV(OCR2BUB) |
+              _BV(TCR2AUB) | _BV(TCR2BUB))) {}
+        #endif
+
+        TIFR2 = _BV(OCF2A) | _BV(OCF2B) | _BV(TOV2);
+            // Bit 1-2 (OCF2x ) =   11 interrupt flag for compare match x
+            // Bit 0   (TOV2  ) =    1 interrupt flag for overflow
+
+        TIMSK2 = _BV(OCIE2A);
+            // Bit 2   (OCIE2B) =    0 interrupt for compare match B
+            // Bit 1   (OCIE2A) =    1 interrupt for compare match A (tick)
+            // Bit 0   (TOIE2 ) =    0 interrupt for overflow
+
+    #elif TICK_SYSTICK == TIMER1          // switch TICK_SYSTICK
+
+        #if   F_CPU / 100 / 1024 > 65536
+            #error "can't setup systick with 16-bit timer - prescaler maximum is 1024"
+
+        #elif F_CPU / 100 /  256 > 65536
+            #define ROBOLIB_TICK_CS  0b101
+            #define ROBOLIB_TICK_DIV 1024
+
+        #elif F_CPU / 100 /   64 > 65536
+            #define ROBOLIB_TICK_CS  0b100
+            #define ROBOLIB_TICK_DIV  256
+
+        #elif F_CPU / 100 /    8 > 65536
+            #define ROBOLIB_TICK_CS  0b011
+            #define ROBOLIB_TICK_DIV   64
+
+        #elif F_CPU / 100 /    1 > 65536
+            #define ROBOLIB_TICK_CS  0b010
+            #define ROBOLIB_TICK_DIV    8
+
+        #else
+            #define ROBOLIB_TICK_CS  0b001
+            #define ROBOLIB_TICK_DIV    1
+        #endif
+        #define ROBOLIB_TICK_MAX ((uint16_t) \
+          ((F_CPU / ROBOLIB_TICK_DIV + 50) / 100 - 1))
 
-    ROBOLIB_TICK_ISR_SEI();
+        // 16-bit Timer
+        // Mode 4 (CTC til OCRnA)
+        ROBOLIB_TICK_TCCRA = 0x00;
+            // Bit 4-7 (COMnxx) =   0000 output mode for A and B
+            // Bit 0-1 (WGMn0x) =     00 select timer mode [WGMn2x in TCCRnB]
 
-    #ifdef ROBOLIB_TICK_FUNCTION
-        ROBOLIB_TICK_FUNCTION();
-    #endif;
+        ROBOLIB_TICK_TCCRB = _BV(WGM12) | (ROBOLIB_TICK_CS & 0x07);
+            // Bit 6-7 (ICxxn ) =   00 input capture (unused)
+            // Bit 3-4 (WGMn2x) =   01 select timer mode [WGMn0x in TCCRnA]
+            // Bit 0-2 (CSnx  ) =  ??? [calculated]
 
-    tick_userfunction();
+        ROBOLIB_TICK_TCNT = 0;
+            // Timer/Counter Register - current value of timer
+
+        ROBOLIB_TICK_OCR = ROBOLIB_TICK_MAX;
+            // Output Compare Register A - top for timer
+
+        ROBOLIB_TICK_TIMSK = _BV(ROBOLIB_TICK_OCIE);
+            // Bit 1   (OCIEnA) =    1 interrupt for compare match A (tick)
+            // others           =    0 no interrupts
+
+        ROBOLIB_TICK_TIFR = 0xFF;
+            // clear all interrupt flags of this timer
 
-    ROBOLIB_TICK_ISR_CLI();
+    #else                                 // switch TICK_SYSTICK
+        #error "timer is not supported (yet) for this device"
+    #endif                                // switch TICK_SYSTICK
 }
@@ -10,44 +10,62 @@
 
 //**************************<File version>*************************************
 #define ROBOLIB_TICK_SUB_VERSION \
-  "robolib/tick/tick_atmega64.c 20.03.2018 V1.1.0"
+  "robolib/tick/tick_atmega64.c 19.10.2026 V1.2.0"
 
-//**************************[tick_init]**************************************** 20.03.2018
+//**************************[tick_init]**************************************** 19.10.2026
 void robolib_tick_init() {
 
+    #if defined(TICK_ASYNC_CLOCK) && (TICK_SYSTICK != TIMER0)
+        #error "TICK_ASYNC_CLOCK is only supported by TIMER0"
+    #endif
+
     #if TICK_SYSTICK == TIMER0 // switch TIMER
 
-        #if   F_CPU / 100 / 1024 > 256
+        #if   ROBOLIB_TICK_CLOCK / 100 / 1024 > 256
             #error "can't setup systick with TIMER0 - prescaler maximum is 1024"
 
-        #elif F_CPU / 100 /  256 > 256
+        #elif ROBOLIB_TICK_CLOCK / 100 /  256 > 256
             #define ROBOLIB_TICK_CS  0b111
-            #define ROBOLIB_TICK_MAX ((uint8_t) (F_CPU / 100 / 1024))
+            #define ROBOLIB_TICK_DIV 1024
 
-        #elif F_CPU / 100 /  128 > 256
+        #elif ROBOLIB_TICK_CLOCK / 100 /  128 > 256
             #define ROBOLIB_TICK_CS  0b110
-            #define ROBOLIB_TICK_MAX ((uint8_t) (F_CPU / 100 /  256))
+            #define ROBOLIB_TICK_DIV  256
 
-        #elif F_CPU / 100 /   64 > 256
+        #elif ROBOLIB_TICK_CLOCK / 100 /   64 > 256
             #define ROBOLIB_TICK_CS  0b101
-            #define ROBOLIB_TICK_MAX ((uint8_t) (F_CPU / 100 /  128))
+            #define ROBOLIB_TICK_DIV  128
 
-        #elif F_CPU / 100 /   32 > 256
+        #elif ROBOLIB_TICK_CLOCK / 100 /   32 > 256
             #define ROBOLIB_TICK_CS  0b100
-            #define ROBOLIB_TICK_MAX ((uint8_t) (F_CPU / 100 /   64))
+            #define ROBOLIB_TICK_DIV   64
 
-        #elif F_CPU / 100 /    8 > 256
+        #elif ROBOLIB_TICK_CLOCK / 100 /    8 > 256
             #define ROBOLIB_TICK_CS  0b011
-            #define ROBOLIB_TICK_MAX ((uint8_t) (F_CPU / 100 /   32))
+            #define ROBOLIB_TICK_DIV   32
 
-        #elif F_CPU / 100 /    1 > 256
+        #elif ROBOLIB_TICK_CLOCK / 100 /    1 > 256
             #define ROBOLIB_TICK_CS  0b010
-            #define ROBOLIB_TICK_MAX ((uint8_t) (F_CPU / 100 /    8))
+            #define ROBOLIB_TICK_DIV    8
 
         #else
             #define ROBOLIB_TICK_CS  0b001
-            #define ROBOLIB_TICK_MAX ((uint8_t) (F_CPU / 100 /    1))
+            #define ROBOLIB_TICK_DIV    1
+        #endif
+        #define ROBOLIB_TICK_MAX ((uint8_t) \
+          ((ROBOLIB_TICK_CLOCK / ROBOLIB_TICK_DIV + 50) / 100 - 1))
+
+        TIMSK&= ~(_BV(OCIE0) | _BV(TOIE0));
+            // disable interrupts of timer0 while (re-)configuring the timer
+
+        #ifdef TICK_ASYNC_CLOCK
+            ASSR = _BV(AS0);
+        #else
+            ASSR = 0;
         #endif
+            // Asynchronous Status Register
+            // Bit 3   (AS0   ) =    ? clocked from TOSC1 [TICK_ASYNC_CLOCK]
+            // Bit 0-2 (..UB  ) =      busy flags (read only)
 
         // 8-bit Timer
         // Modus 2 (CTC bis OCRA)
@@ -63,18 +81,10 @@ void robolib_tick_init() {
         OCR0  = ROBOLIB_TICK_MAX;
             // Output Compare Register - top for timer
 
-        ASSR = 0;
-            // Asynchronous Status Register - Timer0 clocked from I/O clock
-
-        TIMSK = _BV(OCIE0);
-            // Bit 7   (OCIE2 ) =    0 [Timer2]
-            // Bit 6   (TOIE2 ) =    0 [Timer2]
-            // Bit 5   (TICIE1) =    0 [Timer1]
-            // Bit 4   (OCIE1A) =    0 [Timer1]
-            // Bit 3   (OCIE1B) =    0 [Timer1]
-            // Bit 2   (TOIE1 ) =    0 [Timer1]
-            // Bit 1   (OCIE0 ) =    1 interrupt for compare match (tick)
-            // Bit 0   (TOIE0 ) =    0 interrupt for overflow
+        #ifdef TICK_ASYNC_CLOCK
+            // wait until all registers are transferred to the async domain
+            while (ASSR & (_BV(TCN0UB) | _BV(OCR0UB) | _BV(TCR0UB))) {}
+        #endif
 
         TIFR = _BV(OCF0) | _BV(TOV0);
             // Bit 7   (OCF2  ) =    0 [Timer2]
@@ -86,29 +96,119 @@ void robolib_tick_init() {
             // Bit 1   (OCF0  ) =    1 interrupt flag for compare match
             // Bit 0   (TOV0  ) =    1 interrupt flag for overflow
 
-        #define ROBOLIB_TICK_ISR ISR(TIMER0_COMP_vect)
-        #define ROBOLIB_TICK_ISR_SEI() ( \
-           { TIMSK&= ~ _BV(OCIE0); sei();})
-        #define ROBOLIB_TICK_ISR_CLI() ( \
-           { cli(); TIMSK|= _BV(OCIE0);})
+        TIMSK|= _BV(OCIE0);
+            // Bit 7   (OCIE2 ) =    - [Timer2]
+            // Bit 6   (TOIE2 ) =    - [Timer2]
+            // Bit 5   (TICIE1) =    - [Timer1]
+            // Bit 4   (OCIE1A) =    - [Timer1]
+            // Bit 3   (OCIE1B) =    - [Timer1]
+            // Bit 2   (TOIE1 ) =    - [Timer1]
+            // Bit 1   (OCIE0 ) =    1 interrupt for compare match (tick)
+            // Bit 0   (TOIE0 ) =    0 interrupt for overflow
+
+    #elif TICK_SYSTICK == TIMER2          // switch TICK_SYSTICK
 
-    #else                                 // switch TICK_SYSTICK
-        #error "timer is not supported (yet) for this device"
-    #endif                                // switch TICK_SYSTICK
-}
+        #if   F_CPU / 100 / 1024 > 256
+            #error "can't setup systick with TIMER2 - prescaler maximum is 1024"
+
+        #elif F_CPU / 100 /  256 > 256
+            #define ROBOLIB_TICK_CS  0b101
+            #define ROBOLIB_TICK_DIV 1024
+
+        #elif F_CPU / 100 /   64 > 256
+            #define ROBOLIB_TICK_CS  0b100
+            #define ROBOLIB_TICK_DIV  256
+
+        #elif F_CPU / 100 /    8 > 256
+            #define ROBOLIB_TICK_CS  0b011
+            #define ROBOLIB_TICK_DIV   64
+
+        #elif F_CPU / 100 /    1 > 256
+            #define ROBOLIB_TICK_CS  0b010
+            #define ROBOLIB_TICK_DIV    8
+
+        #else
+            #define ROBOLIB_TICK_CS  0b001
+            #define ROBOLIB_TICK_DIV    1
+        #endif
+        #define ROBOLIB_TICK_MAX ((uint8_t) \
+          ((F_CPU / ROBOLIB_TICK_DIV + 50) / 100 - 1))
+
+        // 8-bit Timer
+        // Modus 2 (CTC bis OCR2)
+        TCCR2 =  _BV(WGM21) | (ROBOLIB_TICK_CS & 0x07);
+            // Bit 6   (WGM20) = 0 select timer mode [WGM21 in TCCR2]
+            // Bit 4-5 (COM2x) = 00 output mode (none)
+            // Bit 3   (WGM21) = 1 select timer mode [WGM20 in TCCR2]
+            // Bit 0-2 (CS2x ) = ??? [calculated]
+
+        TCNT2 = 0;
+            // Timer/Counter Register - current value of timer
+
+        OCR2  = ROBOLIB_TICK_MAX;
+            // Output Compare Register - top for timer
+
+        TIFR = _BV(OCF2) | _BV(TOV2);
+            // Bit 7   (OCF2  ) =    1 interrupt flag for compare match
+            // Bit 6   (TOV2  ) =    1 interrupt flag for overflow
+            // Bit 0-5          =    0 [Timer0 & Timer1]
+
+        TIMSK|= _BV(OCIE2);
+            // Bit 7   (OCIE2 ) =    1 interrupt for compare match (tick)
+            // Bit 0-6          =    - [Timer0 & Timer1 & Timer2 overflow]
+
+    #elif (TICK_SYSTICK == TIMER1) || (TICK_SYSTICK == TIMER3)
+
+        #if   F_CPU / 100 / 1024 > 65536
+            #error "can't setup systick with 16-bit timer - prescaler maximum is 1024"
+
+        #elif F_CPU / 100 /  256 > 65536
+            #define ROBOLIB_TICK_CS  0b101
+            #define ROBOLIB_TICK_DIV 1024
+
+        #elif F_CPU / 100 /   64 > 65536
+            #define ROBOLIB_TICK_CS  0b100
+            #define ROBOLIB_TICK_DIV  256
+
+        #elif F_CPU / 100 /    8 > 65536
+            #define ROBOLIB_TICK_CS  0b011
+            #define ROBOLIB_TICK_DIV   64
+
+        #elif F_CPU / 100 /    1 > 65536
+            #define ROBOLIB_TICK_CS  0b010
+            #define ROBOLIB_TICK_DIV    8
+
+        #else
+            #define ROBOLIB_TICK_CS  0b001
+            #define ROBOLIB_TICK_DIV    1
+        #endif
+        #define ROBOLIB_TICK_MAX ((uint16_t) \
+          ((F_CPU / ROBOLIB_TICK_DIV + 50) / 100 - 1))
+
+        // 16-bit Timer
+        // Modus 4 (CTC bis OCRnA)
+        ROBOLIB_TICK_TCCRA = 0x00;
+            // Bit 2-7 (COMnxx) = 000000 output mode for A, B and C
+            // Bit 0-1 (WGMn0x) =     00 select timer mode [WGMn2x in TCCRnB]
 
-//**************************[ISR(tick)]**************************************** 20.03.2018
-ROBOLIB_TICK_ISR {
+        ROBOLIB_TICK_TCCRB = _BV(WGM12) | (ROBOLIB_TICK_CS & 0x07);
+            // Bit 6-7 (ICxxn ) =   00 input capture (unused)
+            // Bit 3-4 (WGMn2x) =   01 select timer mode [WGMn0x in TCCRnA]
+            // Bit 0-2 (CSnx  ) =  ??? [calculated]
 
-    robolib_tick_time++;
+        ROBOLIB_TICK_TCNT = 0;
+            // Timer/Counter Register - current value of timer
 
-    ROBOLIB_TICK_ISR_SEI();
+        ROBOLIB_TICK_OCR = ROBOLIB_TICK_MAX;
+            // Output Compare Register A - top for timer
 
-    #ifdef ROBOLIB_TICK_FUNCTION
-        ROBOLIB_TICK_FUNCTION();
-    #endif;
+        ROBOLIB_TICK_TIFR = _BV(ROBOLIB_TICK_OCF);
+            // clear interrupt flag for compare match A (TIFR or ETIFR)
 
-    tick_userfunction();
+        ROBOLIB_TICK_TIMSK|= _BV(ROBOLIB_TICK_OCIE);
+            // interrupt for compare match A (TIMSK or ETIMSK)
 
-    ROBOLIB_TICK_ISR_CLI();
+    #else                                 // switch TICK_SYSTICK
+        #error "timer is not supported (yet) for this device"
+    #endif                                // switch TICK_SYSTICK
 }
@@ -0,0 +1,220 @@
+/******************************************************************************
+* tick/tick_atmega644p.c                                                      *
+* ======================                                                      *
+*                                                                             *
+* Author : Peter Weissig                                                      *
+*                                                                             *
+* For help or bug report please visit:                                        *
+*   https://github.com/RoboAG/avr_robolib                                     *
+******************************************************************************/
+
+//**************************<File version>*************************************
+#define ROBOLIB_TICK_SUB_VERSION \
+  "robolib/tick/tick_atmega644p.c 19.10.2026 V1.0.0"
+
+//**************************[tick_init]**************************************** 19.10.2026
+void robolib_tick_init() {
+
+    #if defined(TICK_ASYNC_CLOCK) && (TICK_SYSTICK != TIMER2)
+        #error "TICK_ASYNC_CLOCK is only supported by TIMER2"
+    #endif
+
+    #if TICK_SYSTICK == TIMER0 // switch TIMER
+
+        #if   F_CPU / 100 / 1024 > 256
+            #error "can't setup systick with TIMER0 - prescaler maximum is 1024"
+
+        #elif F_CPU / 100 /  256 > 256
+            #define ROBOLIB_TICK_CS  0b101
+            #define ROBOLIB_TICK_DIV 1024
+
+        #elif F_CPU / 100 /   64 > 256
+            #define ROBOLIB_TICK_CS  0b100
+            #define ROBOLIB_TICK_DIV  256
+
+        #elif F_CPU / 100 /    8 > 256
+            #define ROBOLIB_TICK_CS  0b011
+            #define ROBOLIB_TICK_DIV   64
+
+        #elif F_CPU / 100 /    1 > 256
+            #define ROBOLIB_TICK_CS  0b010
+            #define ROBOLIB_TICK_DIV    8
+
+        #else
+            #define ROBOLIB_TICK_CS  0b001
+            #define ROBOLIB_TICK_DIV    1
+        #endif
+        #define ROBOLIB_TICK_MAX ((uint8_t) \
+          ((F_CPU / ROBOLIB_TICK_DIV + 50) / 100 - 1))
+
+        // 8-bit Timer
+        // Mode 2 (CTC until OCRA)
+        TCCR0A =  _BV(WGM01);
+            // Bit 6-7 (COM0Ax) =   00 output mode (none)
+            // Bit 4-5 (COM0Bx) =   00 output mode (none)
+            // Bit 2-3 (  -   ) =      reserved
+            // Bit 0-1 (WGM0x ) =   10 select timer mode [WGM02 in TCCR0B]
+
+        TCCR0B = (ROBOLIB_TICK_CS & 0x07);
+            // Bit 6-7 (FOC0n)  =    0 force output compare (none)
+            // Bit 4-5 (  -   ) =      reserved
+            // Bit 3   (WGM02 ) =    0 select timer mode [WGM0x in TCCR0A]
+            // Bit 0-2 (CS0x  ) =  ??? [calculated]
+
+        TCNT0 = 0;
+            // Timer/Counter Register - current value of timer
+
+        OCR0A  = ROBOLIB_TICK_MAX;
+            // Output Compare Register - top for timer
+
+        TIMSK0 = _BV(OCIE0A);
+            // Bit 3-7 (  -   ) =      reserved
+            // Bit 2   (OCIE0B) =    0 interrupt for compare match B
+            // Bit 1   (OCIE0A) =    1 interrupt for compare match A (tick)
+            // Bit 0   (TOIE0 ) =    0 interrupt for overflow
+
+        TIFR0 = _BV(OCF0A);
+            // Bit 3-7 (  -   ) =      reserved
+            // Bit 2   (OCF0B ) =    0 interrupt for compare match B
+            // Bit 1   (OCF0A ) =    1 interrupt for compare match A (tick)
+            // Bit 0   (TOV0  ) =    0 interrupt for overflow
+
+    #elif TICK_SYSTICK == TIMER2          // switch TICK_SYSTICK
+
+        #if   ROBOLIB_TICK_CLOCK / 100 / 1024 > 256
+            #error "can't setup systick with TIMER2 - prescaler maximum is 1024"
+
+        #elif ROBOLIB_TICK_CLOCK / 100 /  256 > 256
+            #define ROBOLIB_TICK_CS  0b111
+            #define ROBOLIB_TICK_DIV 1024
+
+        #elif ROBOLIB_TICK_CLOCK / 100 /  128 > 256
+            #define ROBOLIB_TICK_CS  0b110
+            #define ROBOLIB_TICK_DIV  256
+
+        #elif ROBOLIB_TICK_CLOCK / 100 /   64 > 256
+            #define ROBOLIB_TICK_CS  0b101
+            #define ROBOLIB_TICK_DIV  128
+
+        #elif ROBOLIB_TICK_CLOCK / 100 /   32 > 256
+            #define ROBOLIB_TICK_CS  0b100
+            #define ROBOLIB_TICK_DIV   64
+
+        #elif ROBOLIB_TICK_CLOCK / 100 /    8 > 256
+            #define ROBOLIB_TICK_CS  0b011
+            #define ROBOLIB_TICK_DIV   32
+
+        #elif ROBOLIB_TICK_CLOCK / 100 /    1 > 256
+            #define ROBOLIB_TICK_CS  0b010
+            #define ROBOLIB_TICK_DIV    8
+
+        #else
+            #define ROBOLIB_TICK_CS  0b001
+            #define ROBOLIB_TICK_DIV    1
+        #endif
+        #define ROBOLIB_TICK_MAX ((uint8_t) \
+          ((ROBOLIB_TICK_CLOCK / ROBOLIB_TICK_DIV + 50) / 100 - 1))
+
+        TIMSK2 = 0x00;
+            // disable all interrupts while (re-)configuring the timer
+
+        // 8-bit Timer (asynchronous)
+        #ifdef TICK_ASYNC_CLOCK
+            ASSR = _BV(AS2);
+        #else
+            ASSR = 0x00;
+        #endif
+            // Bit 6   (EXCLK ) =    0 crystal oscillator (no external clock)
+            // Bit 5   (AS2   ) =    ? clocked from TOSC1 [TICK_ASYNC_CLOCK]
+            // Bit 0-4 (..UB  ) =      busy flags (read only)
+
+        // Mode 2 (CTC til OCRA)
+        TCCR2A =  _BV(WGM21);
+            // Bit 4-7 (COM2xx) = 0000 output mode for A and B
+            // Bit 0-1 (WGM2x ) =  010 select timer mode [WGM22 in TCCR2B]
+
+        TCCR2B =  (ROBOLIB_TICK_CS & 0x07);
+            // Bit 6-7 (FOC2x ) =   00 force output compare
+            // Bit 3   (WGM22 ) =    0 [see WGM2x in TCCR2A]
+            // Bit 0-2 (CS2x  ) =  ??? [calculated]
+
+        TCNT2 = 0;
+            // Timer/Counter Register - current value of timer
+
+        OCR2A = ROBOLIB_TICK_MAX;
+            // Output Compare Register A - top for timer
+
+        OCR2B = 0;
+            // Output Compare Register B - unused
+
+        #ifdef TICK_ASYNC_CLOCK
+            // wait until all registers are transferred to the async domain
+            while (ASSR & (_BV(TCN2UB) | _BV(OCR2AUB) | _BV(OCR2BUB) |
+              _BV(TCR2AUB) | _BV(TCR2BUB))) {}
+        #endif
+
+        TIFR2 = _BV(OCF2A) | _BV(OCF2B) | _BV(TOV2);
+            // Bit 1-2 (OCF2x ) =   11 interrupt flag for compare match x
+            // Bit 0   (TOV2  ) =    1 interrupt flag for overflow
+
+        TIMSK2 = _BV(OCIE2A);
+            // Bit 2   (OCIE2B) =    0 interrupt for compare match B
+            // Bit 1   (OCIE2A) =    1 interrupt for compare match A (tick)
+            // Bit 0   (TOIE2 ) =    0 interrupt for overflow
+
+    #elif TICK_SYSTICK == TIMER1          // switch TICK_SYSTICK
+
+        #if   F_CPU / 100 / 1024 > 65536
+            #error "can't setup systick with 16-bit timer - prescaler maximum is 1024"
+
+        #elif F_CPU / 100 /  256 > 65536
+            #define ROBOLIB_TICK_CS  0b101
+            #define ROBOLIB_TICK_DIV 1024
+
+        #elif F_CPU / 100 /   64 > 65536
+            #define ROBOLIB_TICK_CS  0b100
+            #define ROBOLIB_TICK_DIV  256
+
+        #elif F_CPU / 100 /    8 > 65536
+            #define ROBOLIB_TICK_CS  0b011
+            #define ROBOLIB_TICK_DIV   64
+
+        #elif F_CPU / 100 /    1 > 65536
+            #define ROBOLIB_TICK_CS  0b010
+            #define ROBOLIB_TICK_DIV    8
+
+        #else
+            #define ROBOLIB_TICK_CS  0b001
+            #define ROBOLIB_TICK_DIV    1
+        #endif
+        #define ROBOLIB_TICK_MAX ((uint16_t) \
+          ((F_CPU / ROBOLIB_TICK_DIV + 50) / 100 - 1))
+
+        // 16-bit Timer
+        // Mode 4 (CTC til OCRnA)
+        ROBOLIB_TICK_TCCRA = 0x00;
+            // Bit 4-7 (COMnxx) =   0000 output mode for A and B
+            // Bit 0-1 (WGMn0x) =     00 select timer mode [WGMn2x in TCCRnB]
+
+        ROBOLIB_TICK_TCCRB = _BV(WGM12) | (ROBOLIB_TICK_CS & 0x07);
+            // Bit 6-7 (ICxxn ) =   00 input capture (unused)
+            // Bit 3-4 (WGMn2x) =   01 select timer mode [WGMn0x in TCCRnA]
+            // Bit 0-2 (CSnx  ) =  ??? [calculated]
+
+        ROBOLIB_TICK_TCNT = 0;
+            // Timer/Counter Register - current value of timer
+
+        ROBOLIB_TICK_OCR = ROBOLIB_TICK_MAX;
+            // Output Compare Register A - top for timer
+
+        ROBOLIB_TICK_TIMSK = _BV(ROBOLIB_TICK_OCIE);
+            // Bit 1   (OCIEnA) =    1 interrupt for compare match A (tick)
+            // others           =    0 no interrupts
+
+        ROBOLIB_TICK_TIFR = 0xFF;
+            // clear all interrupt flags of this timer
+
+    #else                                 // switch TICK_SYSTICK
+        #error "timer is not supported (yet) for this device"
+    #endif                                // switch TICK_SYSTICK
+}
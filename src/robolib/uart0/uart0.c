@@ -10,13 +10,14 @@
 
 //**************************<File version>*************************************
 #define ROBOLIB_UART0_VERSION \
-  "robolib/uart0/uart0.c 29.10.2017 V1.0.3"
+  "robolib/uart0/uart0.c 19.10.2026 V1.0.4"
 
 //**************************<Included files>***********************************
 #include <robolib/uart0.h>
 
 #include <robolib/assembler.h>
 #include <robolib/string.h>
+#include <robolib/tick.h>
 #include <robolib/types.h>
 
 #include <avr/io.h>
@@ -34,6 +35,9 @@
     volatile uint8_t robolib_uart0_rx_end;
 #endif //#ifdef UART0_RX
 
+// source file of sections with disabled interrupts (TICK_LATENCY)
+ROBOLIB_TICK_CLI_FILE()
+
 //**************************<Prototypes>***************************************
 
 //**************************<Renaming>*****************************************
@@ -137,6 +141,7 @@ void uart0_send(uint8_t data) {
         uint8_t mSREG = SREG;
 
         cli();
+        ROBOLIB_TICK_CLI_BEGIN(mSREG);
         uint8_t temp_start = robolib_uart0_tx_start;
         uint8_t temp_end   = robolib_uart0_tx_end  ;
 
@@ -146,6 +151,7 @@ void uart0_send(uint8_t data) {
                 if (UCSR0A & _BV(UDRE0)) {
                     UDR0 = data;
 
+                    ROBOLIB_TICK_CLI_END(mSREG);
                     SREG = mSREG;
                     return 0xFF;
                 }
@@ -163,6 +169,7 @@ void uart0_send(uint8_t data) {
 
         // check if buffer is full
         if (temp_start == temp_end) {
+            ROBOLIB_TICK_CLI_END(mSREG);
             SREG = mSREG;
             return 0x00;
         }
@@ -175,6 +182,7 @@ void uart0_send(uint8_t data) {
             UCSR0B|= _BV(UDRIE0);
         }
 
+        ROBOLIB_TICK_CLI_END(mSREG);
         SREG = mSREG;
         return 0xFF;
     }
@@ -184,8 +192,10 @@ void uart0_send(uint8_t data) {
         uint8_t mSREG = SREG;
 
         cli();
+        ROBOLIB_TICK_CLI_BEGIN(mSREG);
 
         if ((UCSR0B & _BV(TXEN0)) == 0x00) {
+            ROBOLIB_TICK_CLI_END(mSREG);
             SREG = mSREG;
             return 0x00;
         }
@@ -193,10 +203,12 @@ void uart0_send(uint8_t data) {
         if (UCSR0A & _BV(UDRE0)) {
             UDR0 = data;
 
+            ROBOLIB_TICK_CLI_END(mSREG);
             SREG = mSREG;
             return 0xFF;
         }
 
+        ROBOLIB_TICK_CLI_END(mSREG);
         SREG = mSREG;
         return 0x00;
     }
@@ -289,6 +301,7 @@ void uart0_send(uint8_t data) {
         uint8_t result;
 
         cli();
+        ROBOLIB_TICK_CLI_BEGIN(mSREG);
         uint8_t temp_start = robolib_uart0_rx_start;
         uint8_t temp_end   = robolib_uart0_rx_end  ;
 
@@ -302,12 +315,14 @@ void uart0_send(uint8_t data) {
             }
             robolib_uart0_rx_start = temp_start;
 
+            ROBOLIB_TICK_CLI_END(mSREG);
             SREG = mSREG;
             return result;
         }
 
         // check if UART0 is disabled
         if ((UCSR0B & _BV(RXEN0)) == 0x00) {
+            ROBOLIB_TICK_CLI_END(mSREG);
             SREG = mSREG;
             return 0x00;
         }
@@ -316,10 +331,12 @@ void uart0_send(uint8_t data) {
         if (UCSR0A & _BV(RXC0)) {
             result = UDR0;
 
+            ROBOLIB_TICK_CLI_END(mSREG);
             SREG = mSREG;
             return result;
         }
 
+        ROBOLIB_TICK_CLI_END(mSREG);
         SREG = mSREG;
         return 0x00;
     }
@@ -330,9 +347,11 @@ void uart0_send(uint8_t data) {
         uint8_t result;
 
         cli();
+        ROBOLIB_TICK_CLI_BEGIN(mSREG);
 
         // check if UART0 is disabled
         if ((UCSR0B & _BV(RXEN0)) == 0x00) {
+            ROBOLIB_TICK_CLI_END(mSREG);
             SREG = mSREG;
             return 0x00;
         }
@@ -341,10 +360,12 @@ void uart0_send(uint8_t data) {
         if (UCSR0A & _BV(RXC0)) {
             result = UDR0;
 
+            ROBOLIB_TICK_CLI_END(mSREG);
             SREG = mSREG;
             return result;
         }
 
+        ROBOLIB_TICK_CLI_END(mSREG);
         SREG = mSREG;
         return 0x00;
     }
@@ -358,6 +379,7 @@ void uart0_send(uint8_t data) {
         uint8_t result;
 
         cli();
+        ROBOLIB_TICK_CLI_BEGIN(mSREG);
 
         uint8_t temp_start = robolib_uart0_tx_start;
         uint8_t temp_end   = robolib_uart0_tx_end  ;
@@ -373,6 +395,7 @@ void uart0_send(uint8_t data) {
             }
         }
 
+        ROBOLIB_TICK_CLI_END(mSREG);
         SREG = mSREG;
         return result;
     }
@@ -383,6 +406,7 @@ void uart0_send(uint8_t data) {
         uint8_t result;
 
         cli();
+        ROBOLIB_TICK_CLI_BEGIN(mSREG);
 
         result = 0x00;
 
@@ -392,6 +416,7 @@ void uart0_send(uint8_t data) {
             }
         }
 
+        ROBOLIB_TICK_CLI_END(mSREG);
         SREG = mSREG;
         return result;
     }
@@ -405,6 +430,7 @@ void uart0_send(uint8_t data) {
         uint8_t result;
 
         cli();
+        ROBOLIB_TICK_CLI_BEGIN(mSREG);
 
         uint8_t temp_start = robolib_uart0_rx_start;
         uint8_t temp_end   = robolib_uart0_rx_end  ;
@@ -420,6 +446,7 @@ void uart0_send(uint8_t data) {
             }
         }
 
+        ROBOLIB_TICK_CLI_END(mSREG);
         SREG = mSREG;
         return result;
     }
@@ -430,6 +457,7 @@ void uart0_send(uint8_t data) {
         uint8_t result;
 
         cli();
+        ROBOLIB_TICK_CLI_BEGIN(mSREG);
 
         result = 0x00;
 
@@ -439,6 +467,7 @@ void uart0_send(uint8_t data) {
             }
         }
 
+        ROBOLIB_TICK_CLI_END(mSREG);
         SREG = mSREG;
         return result;
     }
@@ -450,6 +479,7 @@ void uart0_flush() {
     uint8_t mSREG = SREG;
 
     cli();
+    ROBOLIB_TICK_CLI_BEGIN(mSREG);
 
     #ifdef UART0_TX
         robolib_uart0_tx_start = 0;
@@ -461,6 +491,7 @@ void uart0_flush() {
         robolib_uart0_rx_end   = 0;
     #endif // #ifdef UART0_RX
 
+    ROBOLIB_TICK_CLI_END(mSREG);
     SREG = mSREG;
 }
 
@@ -488,8 +519,10 @@ uint8_t uart0_baud_set(uint16_t baudrate) {
     }
 
     cli();
+    ROBOLIB_TICK_CLI_BEGIN(mSREG);
     UBRR0H = temp.lh;
     UBRR0L = temp.ll;
+    ROBOLIB_TICK_CLI_END(mSREG);
     SREG = mSREG;
 
     return 0xFF;
@@ -505,8 +538,10 @@ uint16_t uart0_baud_get(void) {
     temp.u = F_CPU / 16;
 
     cli();
+    ROBOLIB_TICK_CLI_BEGIN(mSREG);
     temp_r.l = UBRR0L;
     temp_r.h = UBRR0H;
+    ROBOLIB_TICK_CLI_END(mSREG);
     SREG = mSREG;
     temp_r.u&= ROBOLIB_UART0_UBRR_MASK;
     temp_r.u++;
@@ -531,6 +566,7 @@ void uart0_enable(void) {
 
     uint8_t mSREG = SREG;
     cli();
+    ROBOLIB_TICK_CLI_BEGIN(mSREG);
 
     UCSR0B|= _BV(TXEN0);
     UCSR0B|= _BV(RXEN0);
@@ -545,6 +581,7 @@ void uart0_enable(void) {
         UCSR0B|= _BV(RXCIE0);
     #endif
 
+    ROBOLIB_TICK_CLI_END(mSREG);
     SREG = mSREG;
 }
 
@@ -553,6 +590,7 @@ void uart0_disable(void) {
 
     uint8_t mSREG = SREG;
     cli();
+    ROBOLIB_TICK_CLI_BEGIN(mSREG);
 
     UCSR0B&= ~_BV(TXEN0);
     UCSR0B&= ~_BV(RXEN0);
@@ -560,6 +598,7 @@ void uart0_disable(void) {
     UCSR0B&= ~_BV(UDRIE0);
     UCSR0B&= ~_BV(RXCIE0);
 
+    ROBOLIB_TICK_CLI_END(mSREG);
     SREG = mSREG;
 }
 
@@ -584,8 +623,10 @@ void robolib_uart0_print(void (*out)(uint8_t)) {
     union uint16 temp;
     uint8_t mSREG = SREG;
     cli();
+    ROBOLIB_TICK_CLI_BEGIN(mSREG);
     temp.l = UBRR0L;
     temp.h = UBRR0H;
+    ROBOLIB_TICK_CLI_END(mSREG);
     SREG = mSREG;
     temp.u&= ROBOLIB_UART0_UBRR_MASK;
     string_from_const_length(out, "  UBRR0", 15); string_from_const(out, ": ");
@@ -10,13 +10,14 @@
 
 //**************************<File version>*************************************
 #define ROBOLIB_UART1_VERSION \
-  "robolib/uart1/uart1.c 29.10.2017 V1.0.2"
+  "robolib/uart1/uart1.c 19.10.2026 V1.0.3"
 
 //**************************<Included files>***********************************
 #include <robolib/uart1.h>
 
 #include <robolib/assembler.h>
 #include <robolib/string.h>
+#include <robolib/tick.h>
 #include <robolib/types.h>
 
 #include <avr/io.h>
@@ -34,6 +35,9 @@
     volatile uint8_t robolib_uart1_rx_end;
 #endif //#ifdef UART1_RX
 
+// source file of sections with disabled interrupts (TICK_LATENCY)
+ROBOLIB_TICK_CLI_FILE()
+
 //**************************<Prototypes>***************************************
 
 //**************************<Files>********************************************
@@ -76,6 +80,7 @@ void uart1_send(uint8_t data) {
         uint8_t mSREG = SREG;
 
         cli();
+        ROBOLIB_TICK_CLI_BEGIN(mSREG);
         uint8_t temp_start = robolib_uart1_tx_start;
         uint8_t temp_end   = robolib_uart1_tx_end  ;
 
@@ -85,6 +90,7 @@ void uart1_send(uint8_t data) {
                 if (UCSR1A & _BV(UDRE1)) {
                     UDR1 = data;
 
+                    ROBOLIB_TICK_CLI_END(mSREG);
                     SREG = mSREG;
                     return 0xFF;
                 }
@@ -102,6 +108,7 @@ void uart1_send(uint8_t data) {
 
         // check if buffer is full
         if (temp_start == temp_end) {
+            ROBOLIB_TICK_CLI_END(mSREG);
             SREG = mSREG;
             return 0x00;
         }
@@ -114,6 +121,7 @@ void uart1_send(uint8_t data) {
             UCSR1B|= _BV(UDRIE1);
         }
 
+        ROBOLIB_TICK_CLI_END(mSREG);
         SREG = mSREG;
         return 0xFF;
     }
@@ -123,8 +131,10 @@ void uart1_send(uint8_t data) {
         uint8_t mSREG = SREG;
 
         cli();
+        ROBOLIB_TICK_CLI_BEGIN(mSREG);
 
         if ((UCSR1B & _BV(TXEN1)) == 0x00) {
+            ROBOLIB_TICK_CLI_END(mSREG);
             SREG = mSREG;
             return 0x00;
         }
@@ -132,10 +142,12 @@ void uart1_send(uint8_t data) {
         if (UCSR1A & _BV(UDRE1)) {
             UDR1 = data;
 
+            ROBOLIB_TICK_CLI_END(mSREG);
             SREG = mSREG;
             return 0xFF;
         }
 
+        ROBOLIB_TICK_CLI_END(mSREG);
         SREG = mSREG;
         return 0x00;
     }
@@ -228,6 +240,7 @@ void uart1_send(uint8_t data) {
         uint8_t result;
 
         cli();
+        ROBOLIB_TICK_CLI_BEGIN(mSREG);
         uint8_t temp_start = robolib_uart1_rx_start;
         uint8_t temp_end   = robolib_uart1_rx_end  ;
 
@@ -241,12 +254,14 @@ void uart1_send(uint8_t data) {
             }
             robolib_uart1_rx_start = temp_start;
 
+            ROBOLIB_TICK_CLI_END(mSREG);
             SREG = mSREG;
             return result;
         }
 
         // check if UART1 is disabled
         if ((UCSR1B & _BV(RXEN1)) == 0x00) {
+            ROBOLIB_TICK_CLI_END(mSREG);
             SREG = mSREG;
             return 0x00;
         }
@@ -255,10 +270,12 @@ void uart1_send(uint8_t data) {
         if (UCSR1A & _BV(RXC1)) {
             result = UDR1;
 
+            ROBOLIB_TICK_CLI_END(mSREG);
             SREG = mSREG;
             return result;
         }
 
+        ROBOLIB_TICK_CLI_END(mSREG);
         SREG = mSREG;
         return 0x00;
     }
@@ -269,9 +286,11 @@ void uart1_send(uint8_t data) {
         uint8_t result;
 
         cli();
+        ROBOLIB_TICK_CLI_BEGIN(mSREG);
 
         // check if UART1 is disabled
         if ((UCSR1B & _BV(RXEN1)) == 0x00) {
+            ROBOLIB_TICK_CLI_END(mSREG);
             SREG = mSREG;
             return 0x00;
         }
@@ -280,10 +299,12 @@ void uart1_send(uint8_t data) {
         if (UCSR1A & _BV(RXC1)) {
             result = UDR1;
 
+            ROBOLIB_TICK_CLI_END(mSREG);
             SREG = mSREG;
             return result;
         }
 
+        ROBOLIB_TICK_CLI_END(mSREG);
         SREG = mSREG;
         return 0x00;
     }
@@ -297,6 +318,7 @@ void uart1_send(uint8_t data) {
         uint8_t result;
 
         cli();
+        ROBOLIB_TICK_CLI_BEGIN(mSREG);
 
         uint8_t temp_start = robolib_uart1_tx_start;
         uint8_t temp_end   = robolib_uart1_tx_end  ;
@@ -312,6 +334,7 @@ void uart1_send(uint8_t data) {
             }
         }
 
+        ROBOLIB_TICK_CLI_END(mSREG);
         SREG = mSREG;
         return result;
     }
@@ -322,6 +345,7 @@ void uart1_send(uint8_t data) {
         uint8_t result;
 
         cli();
+        ROBOLIB_TICK_CLI_BEGIN(mSREG);
 
         result = 0x00;
 
@@ -331,6 +355,7 @@ void uart1_send(uint8_t data) {
             }
         }
 
+        ROBOLIB_TICK_CLI_END(mSREG);
         SREG = mSREG;
         return result;
     }
@@ -344,6 +369,7 @@ void uart1_send(uint8_t data) {
         uint8_t result;
 
         cli();
+        ROBOLIB_TICK_CLI_BEGIN(mSREG);
 
         uint8_t temp_start = robolib_uart1_rx_start;
         uint8_t temp_end   = robolib_uart1_rx_end  ;
@@ -359,6 +385,7 @@ void uart1_send(uint8_t data) {
             }
         }
 
+        ROBOLIB_TICK_CLI_END(mSREG);
         SREG = mSREG;
         return result;
     }
@@ -369,6 +396,7 @@ void uart1_send(uint8_t data) {
         uint8_t result;
 
         cli();
+        ROBOLIB_TICK_CLI_BEGIN(mSREG);
 
         result = 0x00;
 
@@ -378,6 +406,7 @@ void uart1_send(uint8_t data) {
             }
         }
 
+        ROBOLIB_TICK_CLI_END(mSREG);
         SREG = mSREG;
         return result;
     }
@@ -389,6 +418,7 @@ void uart1_flush() {
     uint8_t mSREG = SREG;
 
     cli();
+    ROBOLIB_TICK_CLI_BEGIN(mSREG);
 
     #ifdef UART1_TX
         robolib_uart1_tx_start = 0;
@@ -400,6 +430,7 @@ void uart1_flush() {
         robolib_uart1_rx_end   = 0;
     #endif // #ifdef UART1_RX
 
+    ROBOLIB_TICK_CLI_END(mSREG);
     SREG = mSREG;
 }
 
@@ -427,8 +458,10 @@ uint8_t uart1_baud_set(uint16_t baudrate) {
     }
 
     cli();
+    ROBOLIB_TICK_CLI_BEGIN(mSREG);
     UBRR1H = temp.lh;
     UBRR1L = temp.ll;
+    ROBOLIB_TICK_CLI_END(mSREG);
     SREG = mSREG;
 
     return 0xFF;
@@ -444,8 +477,10 @@ uint16_t uart1_baud_get(void) {
     temp.u = F_CPU / 16;
 
     cli();
+    ROBOLIB_TICK_CLI_BEGIN(mSREG);
     temp_r.l = UBRR1L;
     temp_r.h = UBRR1H;
+    ROBOLIB_TICK_CLI_END(mSREG);
     SREG = mSREG;
     temp_r.u&= ROBOLIB_UART1_UBRR_MASK;
     temp_r.u++;
@@ -470,6 +505,7 @@ void uart1_enable(void) {
 
     uint8_t mSREG = SREG;
     cli();
+    ROBOLIB_TICK_CLI_BEGIN(mSREG);
 
     UCSR1B|= _BV(TXEN1);
     UCSR1B|= _BV(RXEN1);
@@ -484,6 +520,7 @@ void uart1_enable(void) {
         UCSR1B|= _BV(RXCIE1);
     #endif
 
+    ROBOLIB_TICK_CLI_END(mSREG);
     SREG = mSREG;
 }
 
@@ -492,6 +529,7 @@ void uart1_disable(void) {
 
     uint8_t mSREG = SREG;
     cli();
+    ROBOLIB_TICK_CLI_BEGIN(mSREG);
 
     UCSR1B&= ~_BV(TXEN1);
     UCSR1B&= ~_BV(RXEN1);
@@ -499,6 +537,7 @@ void uart1_disable(void) {
     UCSR1B&= ~_BV(UDRIE1);
     UCSR1B&= ~_BV(RXCIE1);
 
+    ROBOLIB_TICK_CLI_END(mSREG);
     SREG = mSREG;
 }
 
@@ -524,8 +563,10 @@ void robolib_uart1_print(void (*out)(uint8_t)) {
     union uint16 temp;
     uint8_t mSREG = SREG;
     cli();
+    ROBOLIB_TICK_CLI_BEGIN(mSREG);
     temp.l = UBRR1L;
     temp.h = UBRR1H;
+    ROBOLIB_TICK_CLI_END(mSREG);
     SREG = mSREG;
     temp.u&= ROBOLIB_UART1_UBRR_MASK;
     string_from_const_length(out, "  UBRR1", 15); string_from_const(out, ": ");